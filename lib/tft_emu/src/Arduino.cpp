@@ -0,0 +1,44 @@
+#include <Arduino.h>
+#include <stdarg.h>
+#include <chrono>
+#include <thread>
+
+static const auto startTime = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+unsigned long micros() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+HostSerial Serial;
+
+void HostSerial::print(const char* text) {
+  if (out_ != nullptr) {
+    fputs(text, out_);
+  }
+}
+
+void HostSerial::println(const char* text) {
+  if (out_ != nullptr) {
+    fputs(text, out_);
+    fputc('\n', out_);
+  }
+}
+
+int HostSerial::printf(const char* format, ...) {
+  if (out_ == nullptr) {
+    return 0;
+  }
+  va_list args;
+  va_start(args, format);
+  int len = vfprintf(out_, format, args);
+  va_end(args);
+  return len;
+}
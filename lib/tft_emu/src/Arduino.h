@@ -0,0 +1,36 @@
+#pragma once
+// Just enough of the Arduino core for the display code and the timer state
+// machine to build on the host
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+
+using std::max;
+using std::min;
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+
+// Serial output goes to stdout (or nowhere after setOutput(nullptr))
+class HostSerial {
+public:
+  void setOutput(FILE* out) { out_ = out; }
+  void print(const char* text);
+  void println(const char* text = "");
+  int printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+  FILE* out_ = stdout;
+};
+
+extern HostSerial Serial;
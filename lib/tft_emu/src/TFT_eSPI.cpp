@@ -0,0 +1,316 @@
+#include "TFT_eSPI.h"
+#include "glcd_font.h"
+
+static inline uint16_t swap16(uint16_t v) {
+  return (v >> 8) | (v << 8);
+}
+
+// ===== CALL ACCOUNTING =====
+
+TFT_eSPI::CallScope::CallScope(TFT_eSPI& tft, SpiCall call) : tft(tft), call(call), startBytes(tft.spiBytes_) {
+  tft.callDepth_++;
+}
+
+TFT_eSPI::CallScope::~CallScope() {
+  if (--tft.callDepth_ == 0 && !tft.sprite_) {
+    tft.callStats_[call].calls++;
+    tft.callStats_[call].bytes += tft.spiBytes_ - startBytes;
+  }
+}
+
+const char* TFT_eSPI::callName(SpiCall call) {
+  static const char* const names[SPI_CALL_KINDS] = {
+    "fillRect", "drawRect", "drawPixel", "drawString",
+    "setAddrWindow", "pushBlock", "pushImage", "pushImageDMA",
+  };
+  return call < SPI_CALL_KINDS ? names[call] : "?";
+}
+
+void TFT_eSPI::resetSpiStats() {
+  spiBytes_ = 0;
+  memset(callStats_, 0, sizeof(callStats_));
+}
+
+void TFT_eSPI::printSpiStats(FILE* out) const {
+  for (int i = 0; i < SPI_CALL_KINDS; i++) {
+    if (callStats_[i].calls > 0) {
+      fprintf(out, "  %-14s %7u calls %10llu bytes\n", callName((SpiCall)i), callStats_[i].calls,
+              (unsigned long long)callStats_[i].bytes);
+    }
+  }
+  fprintf(out, "  %-14s %7s       %10llu bytes\n", "total", "", (unsigned long long)spiBytes_);
+}
+
+// ===== FRAMEBUFFER =====
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) {
+  // Panel is used in rotation 1 (landscape) only
+  width_ = (w > 0 && h > 0) ? SCREEN_W : 0;
+  height_ = (w > 0 && h > 0) ? SCREEN_H : 0;
+  if (width_ > 0) {
+    fb_ = (uint16_t*)calloc(width_ * height_, sizeof(uint16_t));
+  }
+  resetViewport();
+}
+
+void TFT_eSPI::store(int32_t x, int32_t y, uint16_t color) {
+  if (x >= 0 && y >= 0 && x < width_ && y < height_) {
+    fb_[y * width_ + x] = sprite_ ? swap16(color) : color;
+  }
+}
+
+void TFT_eSPI::plot(int32_t x, int32_t y, uint16_t color) {
+  if (x >= vpX_ && y >= vpY_ && x < vpX_ + vpW_ && y < vpY_ + vpH_) {
+    store(x, y, color);
+  }
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) const {
+  if (x < 0 || y < 0 || x >= width_ || y >= height_) {
+    return 0;
+  }
+  uint16_t color = fb_[y * width_ + x];
+  return sprite_ ? swap16(color) : color;
+}
+
+uint32_t TFT_eSPI::framebufferHash() const {
+  uint32_t h = 2166136261u;
+  const uint8_t* p = (const uint8_t*)fb_;
+  for (size_t i = 0; i < (size_t)width_ * height_ * sizeof(uint16_t); i++) {
+    h = (h ^ p[i]) * 16777619u;
+  }
+  return h;
+}
+
+bool TFT_eSPI::writePPM(const char* path) const {
+  FILE* f = fopen(path, "wb");
+  if (f == nullptr) {
+    return false;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", width_, height_);
+  for (int i = 0; i < width_ * height_; i++) {
+    uint16_t c = readPixel(i % width_, i / width_);
+    uint8_t r = (c >> 11) & 0x1F, g = (c >> 5) & 0x3F, b = c & 0x1F;
+    uint8_t rgb[3] = { (uint8_t)((r << 3) | (r >> 2)), (uint8_t)((g << 2) | (g >> 4)), (uint8_t)((b << 3) | (b >> 2)) };
+    fwrite(rgb, 1, 3, f);
+  }
+  return fclose(f) == 0;
+}
+
+// ===== VIEWPORT =====
+
+void TFT_eSPI::setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum) {
+  int32_t x1 = min(x + w, (int32_t)width_), y1 = min(y + h, (int32_t)height_);
+  vpX_ = max(x, (int32_t)0);
+  vpY_ = max(y, (int32_t)0);
+  vpW_ = max(x1 - vpX_, (int32_t)0);
+  vpH_ = max(y1 - vpY_, (int32_t)0);
+  xDatum_ = vpDatum ? x : 0;
+  yDatum_ = vpDatum ? y : 0;
+}
+
+void TFT_eSPI::resetViewport() {
+  vpX_ = vpY_ = xDatum_ = yDatum_ = 0;
+  vpW_ = width_;
+  vpH_ = height_;
+}
+
+bool TFT_eSPI::clipToViewport(int32_t& x, int32_t& y, int32_t& w, int32_t& h) const {
+  x += xDatum_;
+  y += yDatum_;
+  int32_t x1 = min(x + w, vpX_ + vpW_), y1 = min(y + h, vpY_ + vpH_);
+  x = max(x, vpX_);
+  y = max(y, vpY_);
+  w = x1 - x;
+  h = y1 - y;
+  return w > 0 && h > 0;
+}
+
+// ===== PRIMITIVES =====
+
+void TFT_eSPI::fillScreen(uint32_t color) {
+  fillRect(0, 0, width_, height_, color);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  CallScope scope(*this, SPI_FILL_RECT);
+  if (!clipToViewport(x, y, w, h)) {
+    return;
+  }
+  for (int32_t row = y; row < y + h; row++) {
+    for (int32_t col = x; col < x + w; col++) {
+      store(col, row, color);
+    }
+  }
+  addBytes(WINDOW_BYTES + 2ull * w * h);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color) {
+  CallScope scope(*this, SPI_DRAW_RECT);
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y + 1, h - 2, color);
+  drawFastVLine(x + w - 1, y + 1, h - 2, color);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t color) {
+  CallScope scope(*this, SPI_DRAW_PIXEL);
+  int32_t w = 1, h = 1;
+  if (clipToViewport(x, y, w, h)) {
+    store(x, y, color);
+    addBytes(WINDOW_BYTES + 2);
+  }
+}
+
+// ===== GLCD TEXT =====
+
+int16_t TFT_eSPI::drawString(const char* str, int32_t x, int32_t y) {
+  CallScope scope(*this, SPI_DRAW_STRING);
+  int32_t w = textWidth(str);
+  int32_t h = fontHeight();
+  x -= (textDatum_ % 3 == 1) ? w / 2 : (textDatum_ % 3 == 2) ? w : 0;
+  y -= (textDatum_ / 3 == 1) ? h / 2 : (textDatum_ / 3 == 2) ? h : 0;
+  for (; *str; str++) {
+    drawChar(*str, x, y);
+    x += 6 * textSize_;
+  }
+  return w;
+}
+
+// As TFT_eSPI 2.5: size 1 with a background is one window per character,
+// anything else is a pixel or a size x size fillRect per font dot
+void TFT_eSPI::drawChar(char c, int32_t x, int32_t y) {
+  bool fillBg = textBg_ != textFg_;
+  uint8_t columns[6] = { 0 };
+  bool printable = c >= GLCD_FIRST && c <= GLCD_LAST;
+  for (int i = 0; i < 5; i++) {
+    columns[i] = printable ? GLCD_FONT[c - GLCD_FIRST][i] : 0x7F;  // The UI draws no others
+  }
+
+  if (textSize_ == 1 && fillBg) {
+    int32_t cx = x, cy = y, cw = 6, ch = 8;
+    if (!clipToViewport(cx, cy, cw, ch)) {
+      return;
+    }
+    for (int j = 0; j < 8; j++) {
+      for (int i = 0; i < 6; i++) {
+        plot(x + xDatum_ + i, y + yDatum_ + j, (columns[i] >> j) & 1 ? textFg_ : textBg_);
+      }
+    }
+    addBytes(WINDOW_BYTES + 2ull * cw * ch);
+    return;
+  }
+
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 8; j++) {
+      bool set = (columns[i] >> j) & 1;
+      if (!set && !fillBg) {
+        continue;
+      }
+      uint16_t color = set ? textFg_ : textBg_;
+      if (textSize_ == 1) {
+        drawPixel(x + i, y + j, color);
+      } else {
+        fillRect(x + i * textSize_, y + j * textSize_, textSize_, textSize_, color);
+      }
+    }
+  }
+}
+
+// ===== RAW WINDOWS =====
+// Address windows are panel coordinates and ignore the viewport
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  CallScope scope(*this, SPI_ADDR_WINDOW);
+  winX0_ = winX_ = x;
+  winY0_ = winY_ = y;
+  winX1_ = x + w - 1;
+  winY1_ = y + h - 1;
+  addBytes(WINDOW_BYTES);
+}
+
+void TFT_eSPI::pushBlock(uint16_t color, uint32_t len) {
+  CallScope scope(*this, SPI_PUSH_BLOCK);
+  for (uint32_t i = 0; i < len; i++) {
+    store(winX_, winY_, color);
+    if (++winX_ > winX1_) {
+      winX_ = winX0_;
+      if (++winY_ > winY1_) {
+        winY_ = winY0_;
+      }
+    }
+  }
+  addBytes(2ull * len);
+}
+
+// Images hold pixels in SPI byte order (as sprites do) unless setSwapBytes
+void TFT_eSPI::pushRect(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data, int32_t stride, bool swapped) {
+  int32_t cx = x, cy = y, cw = w, ch = h;
+  if (!clipToViewport(cx, cy, cw, ch)) {
+    return;
+  }
+  int32_t dx = cx - x - xDatum_, dy = cy - y - yDatum_;
+  for (int32_t row = 0; row < ch; row++) {
+    for (int32_t col = 0; col < cw; col++) {
+      uint16_t c = data[(dy + row) * stride + dx + col];
+      store(cx + col, cy + row, swapped ? swap16(c) : c);
+    }
+  }
+  addBytes(WINDOW_BYTES + 2ull * cw * ch);
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data) {
+  CallScope scope(*this, SPI_PUSH_IMAGE);
+  pushRect(x, y, w, h, data, w, !swapBytes_);
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer) {
+  CallScope scope(*this, SPI_PUSH_IMAGE_DMA);
+  pushRect(x, y, w, h, data, w, !swapBytes_);
+}
+
+// Same blend as TFT_eSPI: 5-bit red/blue and 6-bit green channels
+uint16_t TFT_eSPI::alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc) {
+  uint32_t rxb = bgc & 0xF81F;
+  rxb += ((fgc & 0xF81F) - rxb) * (alpha >> 2) >> 6;
+  uint32_t xgx = bgc & 0x07E0;
+  xgx += ((fgc & 0x07E0) - xgx) * alpha >> 8;
+  return (rxb & 0xF81F) | (xgx & 0x07E0);
+}
+
+// ===== SPRITE =====
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI* tft) : TFT_eSPI(0, 0), tft_(tft) {
+  sprite_ = true;
+}
+
+void* TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t frames) {
+  deleteSprite();
+  fb_ = (uint16_t*)calloc(w * h, sizeof(uint16_t));
+  if (fb_ != nullptr) {
+    width_ = w;
+    height_ = h;
+  }
+  resetViewport();
+  return fb_;
+}
+
+void TFT_eSprite::deleteSprite() {
+  free(fb_);
+  fb_ = nullptr;
+  width_ = height_ = 0;
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  CallScope scope(*tft_, SPI_PUSH_IMAGE);
+  tft_->pushRect(x, y, width_, height_, fb_, width_, true);
+}
+
+bool TFT_eSprite::pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh) {
+  if (sx < 0 || sy < 0 || sw <= 0 || sh <= 0 || sx + sw > width_ || sy + sh > height_) {
+    return false;
+  }
+  CallScope scope(*tft_, SPI_PUSH_IMAGE);
+  tft_->pushRect(tx, ty, sw, sh, fb_ + sy * width_ + sx, width_, true);
+  return true;
+}
@@ -0,0 +1,173 @@
+#pragma once
+// ===== TFT_eSPI EMULATOR =====
+// Host build of the TFT_eSPI calls the UI makes, drawing into an in-memory
+// 320x240 RGB565 framebuffer (rotation 1). Every call also adds up the
+// bytes the real driver would have clocked out over SPI, so redraw cost
+// can be compared between builds without a board.
+//
+// SPI model: each address window costs WINDOW_BYTES (CASET, RASET and
+// RAMWR with their parameters) plus 2 bytes per pixel. Primitives are
+// decomposed the way TFT_eSPI 2.5 does it: drawRect is four fast lines,
+// and GLCD characters above size 1 are one fillRect per font dot. Text
+// uses the GLCD glyphs in glcd_font.h, so a frame hashes the same on
+// every host.
+
+#include <Arduino.h>
+
+#define TL_DATUM 0  // Top left
+#define TC_DATUM 1  // Top centre
+#define TR_DATUM 2  // Top right
+#define ML_DATUM 3  // Middle left
+#define MC_DATUM 4  // Middle centre
+#define MR_DATUM 5  // Middle right
+#define BL_DATUM 6  // Bottom left
+#define BC_DATUM 7  // Bottom centre
+#define BR_DATUM 8  // Bottom right
+
+#define TFT_BLACK  0x0000
+#define TFT_BLUE   0x001F
+#define TFT_RED    0xF800
+#define TFT_GREEN  0x07E0
+#define TFT_YELLOW 0xFFE0
+#define TFT_WHITE  0xFFFF
+
+// Public drawing calls, for the per-call byte table
+enum SpiCall : uint8_t {
+  SPI_FILL_RECT,
+  SPI_DRAW_RECT,
+  SPI_DRAW_PIXEL,
+  SPI_DRAW_STRING,
+  SPI_ADDR_WINDOW,
+  SPI_PUSH_BLOCK,
+  SPI_PUSH_IMAGE,
+  SPI_PUSH_IMAGE_DMA,
+  SPI_CALL_KINDS
+};
+
+struct SpiCallStats {
+  uint32_t calls;
+  uint64_t bytes;
+};
+
+class TFT_eSPI {
+public:
+  static const int16_t SCREEN_W = 320;
+  static const int16_t SCREEN_H = 240;
+  static const uint32_t WINDOW_BYTES = 11;
+
+  TFT_eSPI(int16_t w = 240, int16_t h = 320);
+  virtual ~TFT_eSPI() { free(fb_); }
+
+  void init(uint8_t tc = 0) {}
+  void setRotation(uint8_t r) {}
+  int16_t width() const { return width_; }
+  int16_t height() const { return height_; }
+
+  void fillScreen(uint32_t color);
+  void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t color);
+  void drawPixel(int32_t x, int32_t y, uint32_t color);
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t color) { fillRect(x, y, w, 1, color); }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t color) { fillRect(x, y, 1, h, color); }
+
+  void setTextColor(uint16_t color) { textFg_ = textBg_ = color; }
+  void setTextColor(uint16_t fg, uint16_t bg, bool bgfill = false) { textFg_ = fg; textBg_ = bg; }
+  void setTextDatum(uint8_t datum) { textDatum_ = datum; }
+  uint8_t getTextDatum() const { return textDatum_; }
+  void setTextSize(uint8_t size) { textSize_ = size > 0 ? size : 1; }
+  void setTextFont(uint8_t font) {}
+  void setCursor(int16_t x, int16_t y) { cursorX_ = x; cursorY_ = y; }
+  int16_t drawString(const char* str, int32_t x, int32_t y);
+  int16_t textWidth(const char* str) const { return strlen(str) * 6 * textSize_; }
+  int16_t fontHeight() const { return 8 * textSize_; }
+
+  void setViewport(int32_t x, int32_t y, int32_t w, int32_t h, bool vpDatum = true);
+  void resetViewport();
+
+  void startWrite() {}
+  void endWrite() {}
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  void pushBlock(uint16_t color, uint32_t len);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data);
+
+  // Transfers complete immediately; the bytes are counted the same
+  bool initDMA(bool ctrl_cs = false) { return true; }
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t* data, uint16_t* buffer = nullptr);
+  bool dmaBusy() { return false; }
+  void dmaWait() {}
+
+  void setSwapBytes(bool swap) { swapBytes_ = swap; }
+  bool getSwapBytes() const { return swapBytes_; }
+
+  uint16_t alphaBlend(uint8_t alpha, uint16_t fgc, uint16_t bgc);
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  }
+
+  // ===== Emulator extras =====
+  uint16_t readPixel(int32_t x, int32_t y) const;
+  const uint16_t* framebuffer() const { return fb_; }
+  uint32_t framebufferHash() const;          // FNV-1a of the framebuffer
+  bool writePPM(const char* path) const;     // Binary PPM, for golden images
+
+  uint64_t spiBytes() const { return spiBytes_; }
+  const SpiCallStats& callStats(SpiCall call) const { return callStats_[call]; }
+  static const char* callName(SpiCall call);
+  void resetSpiStats();
+  void printSpiStats(FILE* out) const;
+
+protected:
+  friend class TFT_eSprite;
+
+  // Attributes the bytes of a public call (and anything it calls) to it
+  struct CallScope {
+    CallScope(TFT_eSPI& tft, SpiCall call);
+    ~CallScope();
+    TFT_eSPI& tft;
+    SpiCall call;
+    uint64_t startBytes;
+  };
+
+  void plot(int32_t x, int32_t y, uint16_t color);  // Viewport-clipped
+  void store(int32_t x, int32_t y, uint16_t color);  // Bounds-clipped only
+  void addBytes(uint64_t bytes) { if (!sprite_) spiBytes_ += bytes; }
+  void drawChar(char c, int32_t x, int32_t y);
+  bool clipToViewport(int32_t& x, int32_t& y, int32_t& w, int32_t& h) const;
+  void pushRect(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t* data, int32_t stride, bool swapped);
+
+  int16_t width_, height_;
+  uint16_t* fb_ = nullptr;
+  bool sprite_ = false;  // Pixels stored byte-swapped, no SPI traffic
+  uint64_t spiBytes_ = 0;
+  SpiCallStats callStats_[SPI_CALL_KINDS] = {};
+  int callDepth_ = 0;
+
+  int32_t vpX_ = 0, vpY_ = 0, vpW_, vpH_;  // Clip rectangle
+  int32_t xDatum_ = 0, yDatum_ = 0;        // Origin offset (setViewport vpDatum)
+  int32_t winX0_ = 0, winY0_ = 0, winX1_ = -1, winY1_ = -1, winX_ = 0, winY_ = 0;
+  uint16_t textFg_ = TFT_WHITE, textBg_ = TFT_WHITE;
+  uint8_t textDatum_ = TL_DATUM, textSize_ = 1;
+  int16_t cursorX_ = 0, cursorY_ = 0;
+  bool swapBytes_ = false;
+};
+
+// Sprites draw into their own buffer (byte-swapped RGB565, as on the
+// device) and cost nothing until pushed
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI* tft);
+  ~TFT_eSprite() override { deleteSprite(); }
+
+  void* createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const { return fb_ != nullptr; }
+  void* setColorDepth(int8_t depth) { return fb_; }
+  void* getPointer() { return fb_; }
+
+  void fillSprite(uint32_t color) { fillRect(0, 0, width_, height_, color); }
+  void pushSprite(int32_t x, int32_t y);
+  bool pushSprite(int32_t tx, int32_t ty, int32_t sx, int32_t sy, int32_t sw, int32_t sh);
+
+private:
+  TFT_eSPI* tft_;
+};
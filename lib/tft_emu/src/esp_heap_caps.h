@@ -0,0 +1,17 @@
+#pragma once
+// Host stand-in: every allocation is "DMA capable"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_8BIT (1 << 2)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) {
+  (void)caps;
+  return malloc(size);
+}
+
+inline void heap_caps_free(void* ptr) {
+  free(ptr);
+}
@@ -0,0 +1,23 @@
+#include "alarm_schedule.h"
+
+Alarm AlarmSchedule::alarm(int index) const {
+  if (index == 0) {
+    return { 0, config_.warningSeconds, SOUND_WARNING, config_.firstGain };
+  }
+  int bell = index - 1;
+  float ramp = config_.maxBells > 1 ? (float)bell / (config_.maxBells - 1) : 0.0f;
+  return { (uint8_t)index, config_.bellSeconds + bell * config_.repeatSeconds, SOUND_TIME_TO_GO,
+           config_.firstGain + (config_.lastGain - config_.firstGain) * ramp };
+}
+
+bool AlarmSchedule::next(int fired, uint32_t elapsedSeconds, Alarm &out) const {
+  if (fired >= count()) {
+    return false;
+  }
+  int index = fired;
+  while (index + 1 < count() && alarm(index + 1).atSeconds <= elapsedSeconds) {
+    index++;
+  }
+  out = alarm(index);
+  return true;
+}
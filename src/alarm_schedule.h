@@ -0,0 +1,43 @@
+#pragma once
+// ===== ALARM SCHEDULE =====
+// When the alerts of a timer session are due and how loud: one warning at
+// the yellow threshold, then the bell at the blue threshold, repeated every
+// repeatSeconds up to maxBells times with its gain ramped from firstGain
+// to lastGain. Times are seconds since the session started, the same clock
+// the background colour follows. main.cpp arms a one-shot timer for the
+// next alarm, so nothing runs between them.
+
+#include "sounds.h"
+
+struct AlarmConfig {
+  uint32_t warningSeconds;  // Yellow threshold
+  uint32_t bellSeconds;     // Blue threshold: the first bell
+  uint32_t repeatSeconds;   // Between bells
+  uint8_t maxBells;         // Then quiet until the next reset
+  float firstGain;          // Warning and first bell
+  float lastGain;           // Last bell
+};
+
+struct Alarm {
+  uint8_t index;            // 0 is the warning, then the bells
+  uint32_t atSeconds;
+  SoundId sound;
+  float gain;
+};
+
+class AlarmSchedule {
+public:
+  explicit AlarmSchedule(const AlarmConfig& config) : config_(config) {}
+
+  int count() const { return 1 + config_.maxBells; }
+  Alarm alarm(int index) const;
+
+  // The alarm to arm next, given how many of this session's alarms have
+  // fired and the time into it: the first one not fired yet, or if several
+  // are already overdue (after an undo, say), only the latest of those.
+  // False once all have fired.
+  bool next(int fired, uint32_t elapsedSeconds, Alarm &out) const;
+
+private:
+  AlarmConfig config_;
+};
@@ -0,0 +1,101 @@
+#include "audio_adpcm.h"
+
+bool AudioGeneratorImaAdpcm::begin(AudioFileSource* source, AudioOutput* out) {
+  if (source == nullptr || out == nullptr || !source->isOpen()) {
+    return false;
+  }
+
+  // The header fits in one block buffer; the data chunk is found by offset
+  ImaWavInfo info;
+  int headerBytes = source->read(block_, sizeof(block_));
+  if (headerBytes <= 0 || !imaParseWav(block_, headerBytes, info) ||
+      !source->seek(info.dataOffset, SEEK_SET)) {
+    Serial.println("ERROR: Not a mono IMA-ADPCM WAV");
+    return false;
+  }
+  return begin(info, source, out);
+}
+
+bool AudioGeneratorImaAdpcm::begin(const ImaWavInfo& info, AudioFileSource* data, AudioOutput* out) {
+  if (data == nullptr || out == nullptr || !data->isOpen()) {
+    return false;
+  }
+  file = data;
+  output = out;
+  info_ = info;
+  dataLeft_ = info_.dataSize;
+  samplesLeft_ = info_.sampleCount != 0 ? info_.sampleCount : UINT32_MAX;
+  pcmCount_ = 0;
+  pcmPos_ = 0;
+  pending_ = false;
+
+  if (!output->SetRate(info_.sampleRate) || !output->SetBitsPerSample(16) ||
+      !output->SetChannels(1) || !output->begin()) {
+    return false;
+  }
+  running = true;
+  return true;
+}
+
+// Stops at the end of the data; returns false without stopping when the
+// source has nothing ready yet
+bool AudioGeneratorImaAdpcm::nextBlock() {
+  if (dataLeft_ < 5) {
+    stop();
+    return false;
+  }
+  int want = dataLeft_ < info_.blockAlign ? dataLeft_ : info_.blockAlign;
+  int got = file->read(block_, want);
+  if (got == 0 && file->isOpen()) {
+    return false;
+  }
+  if (got != want) {
+    stop();
+    return false;
+  }
+  dataLeft_ -= got;
+  pcmCount_ = imaDecodeBlock(block_, got, pcm_);
+  pcmPos_ = 0;
+  if (pcmCount_ <= 0) {
+    stop();
+    return false;
+  }
+  return true;
+}
+
+// Like AudioGeneratorWAV::loop(), keep going until the output buffer is
+// full; a sample the output refused is offered again first next time
+bool AudioGeneratorImaAdpcm::loop() {
+  while (running) {
+    if (!pending_) {
+      if (samplesLeft_ == 0) {
+        stop();
+        break;
+      }
+      if (pcmPos_ >= pcmCount_ && !nextBlock()) {
+        break;
+      }
+      int16_t sample = pcm_[pcmPos_++];
+      samplesLeft_--;
+      lastSample[AudioOutput::LEFTCHANNEL] = sample;
+      lastSample[AudioOutput::RIGHTCHANNEL] = sample;
+      pending_ = true;
+    }
+    if (!output->ConsumeSample(lastSample)) {
+      break;
+    }
+    pending_ = false;
+  }
+  file->loop();
+  output->loop();
+  return running;
+}
+
+bool AudioGeneratorImaAdpcm::stop() {
+  if (!running) {
+    return true;
+  }
+  running = false;
+  output->stop();
+  return file->close();
+}
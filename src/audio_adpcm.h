@@ -0,0 +1,38 @@
+#pragma once
+// ===== IMA-ADPCM GENERATOR =====
+// ESP8266Audio generator for the mono IMA-ADPCM WAVs produced by
+// tools/gen_sound_adpcm.py. Works from any AudioFileSource, one block at a
+// time: 512 bytes of ADPCM in, 1017 samples out, instead of the whole file.
+//
+// A source that reads ahead (AudioFileSourceReadAhead) may have no block
+// ready yet; read() returning 0 while the source is still open is taken as
+// "not yet", and the block is asked for again on the next loop().
+
+#include "AudioGenerator.h"
+#include "ima_adpcm.h"
+
+class AudioGeneratorImaAdpcm : public AudioGenerator {
+public:
+  // Parse the WAV header from the source, then play its data
+  bool begin(AudioFileSource* source, AudioOutput* output) override;
+  // Play a source already positioned at the data chunk of a WAV whose
+  // header has been parsed into 'info'
+  bool begin(const ImaWavInfo& info, AudioFileSource* data, AudioOutput* output);
+  bool loop() override;
+  bool stop() override;
+  bool isRunning() override { return running; }
+
+  const ImaWavInfo& info() const { return info_; }
+
+private:
+  bool nextBlock();
+
+  ImaWavInfo info_ = {};
+  uint32_t dataLeft_ = 0;     // ADPCM bytes not yet read
+  uint32_t samplesLeft_ = 0;  // Samples still to play (drops the last block's padding)
+  uint8_t block_[IMA_MAX_BLOCK_ALIGN];
+  int16_t pcm_[IMA_MAX_BLOCK_SAMPLES];
+  int pcmCount_ = 0;
+  int pcmPos_ = 0;
+  bool pending_ = false;      // lastSample holds a sample the output has not taken
+};
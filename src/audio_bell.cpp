@@ -0,0 +1,49 @@
+#include "audio_bell.h"
+
+bool AudioGeneratorBell::begin(const BellSound& sound, AudioOutput* out) {
+  if (out == nullptr) {
+    return false;
+  }
+  output = out;
+  if (!output->SetRate(BELL_RATE) || !output->SetBitsPerSample(16) ||
+      !output->SetChannels(1) || !output->begin()) {
+    return false;
+  }
+  synth_.start(sound, BELL_RATE);
+  pcmCount_ = 0;
+  pcmPos_ = 0;
+  lastSample[AudioOutput::LEFTCHANNEL] = 0;
+  lastSample[AudioOutput::RIGHTCHANNEL] = 0;
+  running = true;
+  return true;
+}
+
+// Same shape as AudioGeneratorImaAdpcm::loop()
+bool AudioGeneratorBell::loop() {
+  if (running && output->ConsumeSample(lastSample)) {
+    do {
+      if (pcmPos_ >= pcmCount_) {
+        pcmCount_ = synth_.render(pcm_, CHUNK);
+        pcmPos_ = 0;
+        if (pcmCount_ == 0) {
+          stop();
+          break;
+        }
+      }
+      int16_t sample = pcm_[pcmPos_++];
+      lastSample[AudioOutput::LEFTCHANNEL] = sample;
+      lastSample[AudioOutput::RIGHTCHANNEL] = sample;
+    } while (output->ConsumeSample(lastSample));
+  }
+  output->loop();
+  return running;
+}
+
+bool AudioGeneratorBell::stop() {
+  if (!running) {
+    return true;
+  }
+  running = false;
+  synth_.stop();
+  return output->stop();
+}
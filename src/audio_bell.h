@@ -0,0 +1,24 @@
+#pragma once
+// ===== BELL GENERATOR =====
+// ESP8266Audio generator that plays a BellSound, rendered by BellSynth as
+// the output asks for samples. There is no file: begin() takes the note data.
+
+#include "AudioGenerator.h"
+#include "bell_synth.h"
+
+class AudioGeneratorBell : public AudioGenerator {
+public:
+  bool begin(AudioFileSource* source, AudioOutput* output) override { return false; }
+  bool begin(const BellSound& sound, AudioOutput* output);
+  bool loop() override;
+  bool stop() override;
+  bool isRunning() override { return running; }
+
+private:
+  static const int CHUNK = 64;  // Samples rendered per BellSynth call
+
+  BellSynth synth_;
+  int16_t pcm_[CHUNK];
+  int pcmCount_ = 0;
+  int pcmPos_ = 0;
+};
@@ -0,0 +1,189 @@
+#include "audio_file_stream.h"
+#include <LittleFS.h>
+#include <esp_timer.h>
+
+bool AudioFileSourceReadAhead::startLoader(UBaseType_t priority, BaseType_t core, uint32_t stackBytes) {
+  stream_ = xStreamBufferCreate(bufferBytes_, 1);
+  commands_ = xQueueCreate(2, sizeof(Command));
+  if (stream_ == nullptr || commands_ == nullptr) {
+    return false;
+  }
+  return xTaskCreatePinnedToCore(loaderTask, "sound-loader", stackBytes, this, priority, nullptr, core) == pdPASS;
+}
+
+// ===== AUDIO TASK SIDE =====
+
+void AudioFileSourceReadAhead::post(const char* path) {
+  Command cmd;
+  cmd.session = ++session_;  // Stops any read of the previous session before the loader sees this
+  strlcpy(cmd.path, path, sizeof(cmd.path));
+  // Only the newest command matters: if the queue is full the loader is
+  // behind, and the older one it holds is already stale
+  if (xQueueSend(commands_, &cmd, 0) != pdTRUE) {
+    xQueueReset(commands_);
+    xQueueSend(commands_, &cmd, 0);
+  }
+}
+
+bool AudioFileSourceReadAhead::open(const char* path) {
+  if (stream_ == nullptr || path == nullptr || strlen(path) >= SOUND_PATH_MAX) {
+    return false;
+  }
+  post(path);
+  open_ = true;
+  pos_ = 0;
+  return true;
+}
+
+uint32_t AudioFileSourceReadAhead::read(void* data, uint32_t len) {
+  if (!ready() || len == 0) {
+    return 0;
+  }
+  if (xStreamBufferBytesAvailable(stream_) < len) {
+    if (doneSession_ != session_ || xStreamBufferBytesAvailable(stream_) == 0) {
+      portENTER_CRITICAL(&lock_);
+      starved_++;
+      portEXIT_CRITICAL(&lock_);
+      return 0;
+    }
+    len = xStreamBufferBytesAvailable(stream_);  // The end of the file
+  }
+  uint32_t got = xStreamBufferReceive(stream_, data, len, 0);
+  pos_ += got;
+  if (doneSession_ != session_) {
+    uint32_t left = xStreamBufferBytesAvailable(stream_);
+    portENTER_CRITICAL(&lock_);
+    if (left < lowWater_) {
+      lowWater_ = left;
+    }
+    portEXIT_CRITICAL(&lock_);
+  }
+  return got;
+}
+
+bool AudioFileSourceReadAhead::close() {
+  if (!open_) {
+    return true;
+  }
+  post("");
+  open_ = false;
+  return true;
+}
+
+ImaWavInfo AudioFileSourceReadAhead::info() const {
+  portENTER_CRITICAL(&lock_);
+  ImaWavInfo info = info_;
+  portEXIT_CRITICAL(&lock_);
+  return info;
+}
+
+AudioFileSourceReadAhead::Stats AudioFileSourceReadAhead::takeStats() {
+  portENTER_CRITICAL(&lock_);
+  Stats stats = { chunks_, worstReadMicros_, worstOpenMicros_, lowWater_, starved_ };
+  chunks_ = worstReadMicros_ = worstOpenMicros_ = starved_ = 0;
+  lowWater_ = UINT32_MAX;
+  portEXIT_CRITICAL(&lock_);
+  return stats;
+}
+
+// ===== LOADER TASK =====
+
+void AudioFileSourceReadAhead::loaderTask(void* param) {
+  static_cast<AudioFileSourceReadAhead*>(param)->runLoader();
+}
+
+// Open 'path', parse its header and leave the file at the ADPCM data.
+// 'left' is set to the data bytes to stream.
+bool AudioFileSourceReadAhead::openData(const char* path, fs::File& file, uint32_t& left) {
+  int64_t start = esp_timer_get_time();
+  file = LittleFS.open(path, "r");
+  if (!file) {
+    Serial.printf("ERROR: Sound file %s not found\n", path);
+    return false;
+  }
+  uint8_t header[CHUNK];
+  size_t got = file.read(header, sizeof(header));
+  ImaWavInfo info;
+  if (!imaParseWav(header, got, info) || !file.seek(info.dataOffset)) {
+    Serial.printf("ERROR: %s is not a mono IMA-ADPCM WAV\n", path);
+    file.close();
+    return false;
+  }
+  left = min(info.dataSize, (uint32_t)(file.size() - info.dataOffset));
+  uint32_t micros = esp_timer_get_time() - start;
+  portENTER_CRITICAL(&lock_);
+  info_ = info;
+  if (micros > worstOpenMicros_) {
+    worstOpenMicros_ = micros;
+  }
+  portEXIT_CRITICAL(&lock_);
+  return true;
+}
+
+// Streams the open file a chunk at a time, waiting for room while the
+// buffer is full but never so long that a new command goes unseen. The
+// session is ready once the buffer is full or the whole file is in it.
+void AudioFileSourceReadAhead::runLoader() {
+  fs::File file;
+  uint32_t loading = 0;  // Session being streamed
+  uint32_t left = 0;     // Its data bytes still in flash
+  uint8_t chunk[CHUNK];
+
+  while (true) {
+    Command cmd;
+    if (xQueueReceive(commands_, &cmd, file ? 0 : portMAX_DELAY) == pdTRUE) {
+      if (file) {
+        file.close();
+      }
+      // Neither side is blocked on the stream here (the audio task never
+      // waits on it, and stops reading as soon as it posts), so it can be reset
+      xStreamBufferReset(stream_);
+      if (cmd.session != session_ || cmd.path[0] == '\0') {
+        continue;  // Closed, or already superseded
+      }
+      loading = cmd.session;
+      if (!openData(cmd.path, file, left)) {
+        failedSession_ = loading;
+        continue;
+      }
+      if (left == 0) {
+        file.close();
+        doneSession_ = readySession_ = loading;
+      }
+      continue;
+    }
+
+    uint32_t n = left < CHUNK ? left : CHUNK;
+    int64_t start = esp_timer_get_time();
+    size_t got = file.read(chunk, n);
+    uint32_t micros = esp_timer_get_time() - start;
+    portENTER_CRITICAL(&lock_);
+    chunks_++;
+    if (micros > worstReadMicros_) {
+      worstReadMicros_ = micros;
+    }
+    portEXIT_CRITICAL(&lock_);
+    if (got != n) {
+      Serial.println("ERROR: Sound file read failed");
+      file.close();
+      failedSession_ = loading;
+      continue;
+    }
+    left -= n;
+
+    size_t sent = 0;
+    while (sent < n && uxQueueMessagesWaiting(commands_) == 0) {
+      sent += xStreamBufferSend(stream_, chunk + sent, n - sent, pdMS_TO_TICKS(POLL_MS));
+    }
+    if (sent < n) {
+      continue;  // A command is waiting; this session is over
+    }
+    if (left == 0) {
+      file.close();
+      doneSession_ = loading;
+    }
+    if (left == 0 || xStreamBufferSpacesAvailable(stream_) < CHUNK) {
+      readySession_ = loading;
+    }
+  }
+}
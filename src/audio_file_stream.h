@@ -0,0 +1,96 @@
+#pragma once
+// ===== SOUND FILE STREAM =====
+// AudioFileSource for the ADPCM sound files in LittleFS (/sounds/, made by
+// tools/gen_sound_adpcm.py) that never touches flash on the audio task. A
+// loader task opens the file, parses its WAV header and reads the data
+// ahead into a RAM stream buffer; read() only takes bytes that are already
+// there. A LittleFS write on another task (logEntry() appending to
+// /logs.txt, a block erase) can hold the loader up; the read-ahead covers
+// that, not the DMA queue.
+//
+// open() and close() are called on the audio task, which then polls
+// ready() and starts the generator with info() (the data is already past
+// the header). Each open() is a new session: the loader drops a file as
+// soon as a newer open() or close() reaches it, and nothing from an old
+// session is read. The header and the stats are shared with the loader
+// (and the loop, which prints them) under a spinlock and copied out.
+
+#include <Arduino.h>
+#include <FS.h>
+#include <freertos/stream_buffer.h>
+#include "AudioFileSource.h"
+#include "ima_adpcm.h"
+
+const int SOUND_PATH_MAX = 48;
+
+class AudioFileSourceReadAhead : public AudioFileSource {
+public:
+  // bufferBytes of read-ahead, allocated by startLoader()
+  explicit AudioFileSourceReadAhead(uint32_t bufferBytes) : bufferBytes_(bufferBytes) {}
+
+  // Allocate the buffer and start the loader task; once, before open()
+  bool startLoader(UBaseType_t priority, BaseType_t core, uint32_t stackBytes);
+
+  // Ask the loader for a file and return at once
+  bool open(const char* path) override;
+  bool ready() const { return open_ && readySession_ == session_; }   // Header parsed, buffer full
+  bool failed() const { return open_ && failedSession_ == session_; } // Missing, unreadable or not ADPCM
+  ImaWavInfo info() const;                                            // Once ready()
+
+  // All of 'len' bytes, or 0 if that much is not buffered yet. Never blocks.
+  uint32_t read(void* data, uint32_t len) override;
+  bool seek(int32_t pos, int dir) override { return false; }
+  bool close() override;
+  bool isOpen() override { return open_ && failedSession_ != session_; }
+  uint32_t getSize() override { return info().dataSize; }
+  uint32_t getPos() override { return pos_; }
+
+  struct Stats {
+    uint32_t chunks;           // Chunks read from flash
+    uint32_t worstReadMicros;  // Longest LittleFS read of one chunk
+    uint32_t worstOpenMicros;  // Longest open and header parse
+    uint32_t lowWater;         // Fewest bytes left buffered after a read, while more was to come
+    uint32_t starved;          // read() calls the buffer could not satisfy
+  };
+  // Stats since the last call, then start again
+  Stats takeStats();
+  uint32_t bufferBytes() const { return bufferBytes_; }
+
+private:
+  static const uint32_t CHUNK = 512;         // Bytes per flash read (one ADPCM block)
+  static const TickType_t POLL_MS = 10;      // Loader's wait for room before checking for commands
+
+  struct Command {
+    uint32_t session;
+    char path[SOUND_PATH_MAX];  // Empty: close
+  };
+
+  static void loaderTask(void* param);
+  void runLoader();
+  bool openData(const char* path, fs::File& file, uint32_t& left);
+  void post(const char* path);
+
+  uint32_t bufferBytes_;
+  StreamBufferHandle_t stream_ = nullptr;
+  QueueHandle_t commands_ = nullptr;
+
+  // Audio task
+  bool open_ = false;
+  uint32_t pos_ = 0;
+
+  // Sessions: the audio task advances session_, the loader marks the
+  // session it has loaded or given up on
+  volatile uint32_t session_ = 0;
+  volatile uint32_t readySession_ = 0;
+  volatile uint32_t failedSession_ = 0;
+  volatile uint32_t doneSession_ = 0;  // All of the data is in the buffer
+
+  // Under lock_: written by the loader and the audio task, taken by the loop
+  mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+  ImaWavInfo info_ = {};
+  uint32_t chunks_ = 0;
+  uint32_t worstReadMicros_ = 0;
+  uint32_t worstOpenMicros_ = 0;
+  uint32_t lowWater_ = UINT32_MAX;
+  uint32_t starved_ = 0;
+};
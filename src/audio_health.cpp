@@ -0,0 +1,16 @@
+#include "audio_health.h"
+#include <stdio.h>
+
+uint32_t AudioHealth::decodeMicrosPer(uint32_t frames) const {
+  return samplesProduced ? (uint32_t)(decodeMicros * frames / samplesProduced) : 0;
+}
+
+void formatAudioHealth(const AudioHealth& health, uint32_t bufferFrames, char* out, size_t size) {
+  if (health.samplesPlayed == 0) {
+    snprintf(out, size, "Audio: nothing played since boot");
+    return;
+  }
+  snprintf(out, size, "Audio: %u underrun%s, gap %u ms, %u us/buffer", (unsigned)health.underruns(),
+           health.underruns() == 1 ? "" : "s", (unsigned)((health.longestGapMicros + 500) / 1000),
+           (unsigned)health.decodeMicrosPer(bufferFrames));
+}
@@ -0,0 +1,28 @@
+#pragma once
+// ===== AUDIO HEALTH =====
+// Counters for the audio pipeline since boot, so a glitch at 3 a.m. shows
+// up in the serial stats and on the logs screen instead of only being
+// heard. The audio task keeps them; others read a copy. Free of board code
+// so the host screens (src/native/) can show a sample.
+
+#include <stdint.h>
+#include <stddef.h>
+
+struct AudioHealth {
+  uint32_t samplesProduced = 0;    // Decoded or synthesized into the mixer voices
+  uint32_t samplesPlayed = 0;      // Moved into the I2S DMA queue
+  uint32_t dmaUnderruns = 0;       // Refills further apart than the DMA queue lasts
+  uint32_t ringUnderruns = 0;      // The ring ran dry while a voice was still playing
+  uint32_t longestGapMicros = 0;   // Between refills (passes over the generators' loop()) while playing
+  uint64_t decodeMicros = 0;       // Time in generator loop() calls
+  uint32_t worstDecodeMicros = 0;  // Longest single loop() call
+
+  uint32_t underruns() const { return dmaUnderruns + ringUnderruns; }
+
+  // Average generator time for 'frames' samples (one DMA buffer)
+  uint32_t decodeMicrosPer(uint32_t frames) const;
+};
+
+// One line for the logs screen, at most 50 characters:
+// "Audio: 0 underruns, gap 6 ms, 41 us/buffer" (the longest gap)
+void formatAudioHealth(const AudioHealth& health, uint32_t bufferFrames, char* out, size_t size);
@@ -0,0 +1,65 @@
+#include "audio_mixer.h"
+
+// Above the knee the excess is mapped to knee + room * over / (over + room):
+// slope 1 at the knee, falling toward 0, and always short of full scale
+static inline int32_t softLimit(int32_t x) {
+  const int32_t room = 32767 - MIXER_KNEE;
+  int32_t over = (x < 0 ? -x : x) - MIXER_KNEE;
+  int32_t y = MIXER_KNEE + room * over / (over + room);
+  return x < 0 ? -y : y;
+}
+
+bool AudioMixer::idle() const {
+  for (const Voice& voice : voices_) {
+    if (voice.producing || voice.ring.available() > 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int AudioMixer::mix(int16_t* out, int count) {
+  // A producing voice that is behind holds everything back; otherwise run
+  // until the longest of the finishing voices is done
+  uint32_t n = count;
+  bool anyProducing = false;
+  for (const Voice& voice : voices_) {
+    if (voice.producing) {
+      n = min(n, voice.ring.available());
+      anyProducing = true;
+    }
+  }
+  if (!anyProducing) {
+    uint32_t longest = 0;
+    for (const Voice& voice : voices_) {
+      longest = max(longest, voice.ring.available());
+    }
+    n = min(n, longest);
+  }
+
+  int16_t samples[MIXER_CHUNK];
+  int32_t sums[MIXER_CHUNK];
+  for (uint32_t done = 0; done < n;) {
+    uint32_t chunk = min(n - done, (uint32_t)MIXER_CHUNK);
+    for (uint32_t i = 0; i < chunk; i++) {
+      sums[i] = 0;
+    }
+    for (Voice& voice : voices_) {
+      uint32_t got = voice.ring.read(samples, chunk);  // Short: silence after
+      int32_t gain = voice.gain;
+      for (uint32_t i = 0; i < got; i++) {
+        sums[i] += samples[i] * gain;
+      }
+    }
+    for (uint32_t i = 0; i < chunk; i++) {
+      int32_t sum = (sums[i] >> 8) * MIXER_HEADROOM >> 8;
+      if (sum > MIXER_KNEE || sum < -MIXER_KNEE) {
+        sum = softLimit(sum);
+        limited_++;
+      }
+      out[done + i] = (int16_t)sum;
+    }
+    done += chunk;
+  }
+  return n;
+}
@@ -0,0 +1,51 @@
+#pragma once
+// ===== AUDIO MIXER =====
+// Fixed set of voices between the generators and the DAC ring. Each voice
+// is a small PcmRing its generator decodes into (through AudioOutputRing);
+// mix() sums them with a per-voice gain in 32 bits, takes the sum down by
+// a fixed headroom and passes it through a soft limiter: linear up to
+// MIXER_KNEE, then bending smoothly toward full scale without reaching it.
+// One voice at full scale stays under the knee and is never touched; an
+// overlap loud enough to pass it is compressed, never clipped. The limiter
+// has no state, so a voice starting or stopping never changes the level of
+// the others in a step. Free of audio library code so the host can time it
+// (src/native/render_sounds.cpp).
+
+#include "pcm_ring.h"
+
+const int MIXER_VOICES = 3;
+const uint32_t MIXER_VOICE_SAMPLES = 512;  // Per voice; 23 ms at 22.05 kHz
+const uint16_t MIXER_UNITY_GAIN = 256;     // Gains are 8.8 fixed point
+const int MIXER_CHUNK = 64;                // Samples summed per pass over the voices
+const int32_t MIXER_HEADROOM = 192;        // Bus gain (8.8): -2.5 dB, so one voice peaks at...
+const int32_t MIXER_KNEE = 24576;          // ...the limiter's knee (3/4 of full scale)
+
+class AudioMixer {
+public:
+  PcmRing& voice(int v) { return voices_[v].ring; }
+  void setGain(int v, uint16_t gain) { voices_[v].gain = gain; }
+
+  // A producing voice has more to come: mix() never runs ahead of it. A
+  // voice that is not producing plays out what it has, then silence.
+  void setProducing(int v, bool producing) { voices_[v].producing = producing; }
+  bool producing(int v) const { return voices_[v].producing; }
+
+  // Mix up to 'count' samples into 'out'. Returns how many were written:
+  // as many as every producing voice has ready (0 if one is empty), or
+  // with none producing, until the last one runs out.
+  int mix(int16_t* out, int count);
+
+  bool idle() const;                          // Nothing producing, nothing left
+  uint32_t limited() const { return limited_; }  // Samples past the knee since boot
+
+private:
+  struct Voice {
+    int16_t samples[MIXER_VOICE_SAMPLES];
+    PcmRing ring{ samples, MIXER_VOICE_SAMPLES };
+    uint16_t gain = MIXER_UNITY_GAIN;
+    bool producing = false;
+  };
+
+  Voice voices_[MIXER_VOICES];
+  uint32_t limited_ = 0;
+};
@@ -0,0 +1,6 @@
+#include "audio_ring_output.h"
+
+bool AudioOutputRing::ConsumeSample(int16_t sample[2]) {
+  int32_t mono = ((int32_t)sample[LEFTCHANNEL] + sample[RIGHTCHANNEL]) / 2;
+  return ring_.push(Amplify((int16_t)mono));
+}
@@ -0,0 +1,24 @@
+#pragma once
+// ===== RING BUFFER AUDIO OUTPUT =====
+// AudioOutput that a generator decodes into: samples go to a PcmRing
+// (mixed down to mono) instead of the DAC, one per mixer voice. Refuses
+// samples while the ring is full, which is how the generator knows to stop
+// decoding for now. SetGain() scales the voice (AudioOutputI2S's gain is
+// the master volume).
+
+#include "AudioOutput.h"
+#include "pcm_ring.h"
+
+class AudioOutputRing : public AudioOutput {
+public:
+  explicit AudioOutputRing(PcmRing& ring) : ring_(ring) { SetGain(1.0f); }
+
+  bool begin() override { return true; }
+  bool ConsumeSample(int16_t sample[2]) override;
+  bool stop() override { return true; }
+
+  int rate() const { return hertz; }  // As set by the generator
+
+private:
+  PcmRing& ring_;
+};
@@ -0,0 +1,111 @@
+#include "bell_synth.h"
+#include <math.h>
+
+static const int SINE_SIZE = 1 << BELL_SINE_BITS;
+static const uint32_t ENV_ONE = 1UL << 16;
+static const uint32_t ENV_SILENT = ENV_ONE >> 8;  // -48 dB, below the DAC's last bit
+static int16_t SINE[SINE_SIZE];
+
+BellSynth::BellSynth() {
+  if (SINE[SINE_SIZE / 4] == 0) {
+    for (int i = 0; i < SINE_SIZE; i++) {
+      SINE[i] = (int16_t)lroundf(32767.0f * sinf(2.0f * (float)M_PI * i / SINE_SIZE));
+    }
+  }
+  stop();
+}
+
+void BellSynth::start(const BellSound& sound, uint32_t rate) {
+  stop();
+  sound_ = &sound;
+  rate_ = rate;
+  // Index in radians, as a phase offset in table steps: index * SINE_SIZE / 2pi
+  peakIndex_ = lroundf(sound.modIndexQ4 * SINE_SIZE / (16 * 2 * (float)M_PI));
+}
+
+void BellSynth::stop() {
+  sound_ = nullptr;
+  position_ = 0;
+  nextNote_ = 0;
+  blockLeft_ = 0;
+  for (Voice& voice : voices_) {
+    voice = {};
+  }
+}
+
+void BellSynth::startNote(const BellNote& note) {
+  // The quietest voice makes way (free voices have env 0)
+  Voice* voice = &voices_[0];
+  for (Voice& candidate : voices_) {
+    if (candidate.env < voice->env) {
+      voice = &candidate;
+    }
+  }
+
+  uint64_t carrierStep = ((uint64_t)note.hz << 32) / rate_;
+  *voice = {};
+  voice->carrierStep = (uint32_t)carrierStep;
+  voice->modStep = (uint32_t)((carrierStep * sound_->modRatioQ8) >> 8);
+  voice->env = ENV_ONE;
+  float blocksPerTau = note.decayCs * 0.01f * rate_ / BELL_CONTROL_SAMPLES;
+  voice->envDecay = (uint32_t)lroundf(ENV_ONE * expf(-1.0f / (blocksPerTau > 0.1f ? blocksPerTau : 0.1f)));
+  voice->peak = note.level * 64;
+}
+
+// Once per control block: due notes start, envelopes step down, and the
+// amplitude and modulation depth follow them
+void BellSynth::control() {
+  while (nextNote_ < sound_->count &&
+         (uint64_t)sound_->notes[nextNote_].atMs * rate_ / 1000 <= position_) {
+    startNote(sound_->notes[nextNote_++]);
+  }
+
+  for (Voice& voice : voices_) {
+    if (voice.env < ENV_SILENT) {
+      voice.env = 0;
+      voice.amp = 0;
+      continue;
+    }
+    voice.amp = (int32_t)(((int64_t)voice.peak * voice.env) >> 16);
+    voice.index = (int32_t)(((int64_t)peakIndex_ * voice.env) >> 16);
+    voice.env = (uint32_t)(((uint64_t)voice.env * voice.envDecay) >> 16);
+  }
+}
+
+int BellSynth::render(int16_t* out, int count) {
+  const int SHIFT = 32 - BELL_SINE_BITS;
+  int written = 0;
+  while (written < count && sound_ != nullptr) {
+    if (blockLeft_ == 0) {
+      control();
+      blockLeft_ = BELL_CONTROL_SAMPLES;
+      bool ringing = nextNote_ < sound_->count;
+      for (const Voice& voice : voices_) {
+        ringing = ringing || voice.amp != 0;
+      }
+      if (!ringing) {
+        stop();
+        break;
+      }
+    }
+
+    int n = min(blockLeft_, count - written);
+    for (int i = 0; i < n; i++) {
+      int32_t mix = 0;
+      for (Voice& voice : voices_) {
+        if (voice.amp == 0) {
+          continue;
+        }
+        int32_t offset = (SINE[voice.modPhase >> SHIFT] * voice.index) >> 15;
+        int32_t carrier = SINE[((voice.carrierPhase >> SHIFT) + offset) & (SINE_SIZE - 1)];
+        mix += (carrier * voice.amp) >> 15;
+        voice.carrierPhase += voice.carrierStep;
+        voice.modPhase += voice.modStep;
+      }
+      out[written++] = (int16_t)(mix > 32767 ? 32767 : mix < -32768 ? -32768 : mix);
+    }
+    blockLeft_ -= n;
+    position_ += n;
+  }
+  return written;
+}
@@ -0,0 +1,64 @@
+#pragma once
+// ===== BELL SYNTHESIZER =====
+// Renders alert sounds from a few note records instead of samples. Each
+// note is a two-operator FM bell: a sine carrier whose phase is pushed
+// around by a sine modulator at an inharmonic ratio, with the modulation
+// index decaying along with the amplitude, so the strike is bright and
+// the tail pure. Integer-only per sample, and free of audio library code
+// so the host can render and time it (src/native/render_sounds.cpp).
+
+#include <Arduino.h>
+
+const uint32_t BELL_RATE = 22050;
+const int BELL_VOICES = 4;             // Notes ringing at once; a new one takes the quietest
+const int BELL_CONTROL_SAMPLES = 16;   // Envelopes and note starts move at this granularity
+const int BELL_SINE_BITS = 9;          // 512-entry sine table
+
+struct BellNote {
+  uint16_t atMs;     // Start, from the start of the sound
+  uint16_t hz;       // Carrier frequency
+  uint8_t level;     // Peak amplitude; 255 is half of full scale
+  uint8_t decayCs;   // Amplitude time constant, in 10 ms units
+};
+
+struct BellSound {
+  const BellNote* notes;   // In start order
+  uint8_t count;
+  uint16_t modRatioQ8;     // Modulator / carrier frequency, 8 fractional bits
+  uint8_t modIndexQ4;      // Modulation index at the strike, 4 fractional bits
+};
+
+class BellSynth {
+public:
+  BellSynth();
+
+  void start(const BellSound& sound, uint32_t rate = BELL_RATE);
+  void stop();
+  bool active() const { return sound_ != nullptr; }
+
+  // Mix up to 'count' samples into 'out' (overwritten). Returns fewer once
+  // the last note has died away, 0 when the sound is over.
+  int render(int16_t* out, int count);
+
+private:
+  struct Voice {
+    uint32_t carrierPhase, carrierStep;
+    uint32_t modPhase, modStep;
+    uint32_t env;          // 16.16, 1.0 at the strike
+    uint32_t envDecay;     // Per control block, 0.16
+    int32_t peak;          // Amplitude at env 1.0
+    int32_t amp;           // Current amplitude (Q15 output scale)
+    int32_t index;         // Current modulation, in sine table steps
+  };
+
+  void control();
+  void startNote(const BellNote& note);
+
+  const BellSound* sound_ = nullptr;
+  uint32_t rate_ = BELL_RATE;
+  int32_t peakIndex_ = 0;    // Modulation at the strike, in sine table steps
+  uint32_t position_ = 0;    // Samples since start
+  int nextNote_ = 0;
+  int blockLeft_ = 0;        // Samples until the next control()
+  Voice voices_[BELL_VOICES];
+};
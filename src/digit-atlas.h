@@ -0,0 +1,250 @@
+// Generated by tools/gen_digit_atlas.py - do not edit by hand
+// Anti-aliased 7-segment glyphs, RLE: [level:2][run-1:6] per byte, row-major
+#pragma once
+#include <Arduino.h>
+
+struct AtlasGlyph {
+  char ch;
+  uint8_t w;
+  uint16_t offset;  // Into the font's RLE data
+  uint16_t size;    // RLE bytes
+};
+
+struct AtlasFont {
+  const AtlasGlyph* glyphs;
+  uint8_t count;
+  uint8_t height;
+  uint8_t spacing;  // Blank columns between glyphs
+  const uint8_t* data;
+};
+
+// timer: 26x44, 11 glyphs, 2111 RLE bytes (23760 bytes as RGB565)
+const uint8_t timerAtlasData[] PROGMEM = {
+  0x06, 0x40, 0x89, 0x40, 0x0C, 0x80, 0xCB, 0x80, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80,
+  0x09, 0x40, 0xCD, 0x40, 0x06, 0x40, 0x80, 0x40, 0x00, 0x80, 0xCB, 0x80, 0x00, 0x40, 0x80, 0x40,
+  0x02, 0x80, 0xC2, 0x80, 0x00, 0x40, 0x89, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x00, 0x40, 0xC4, 0x40,
+  0x0B, 0x40, 0xC4, 0x40, 0x80, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4,
+  0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B,
+  0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4,
+  0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x80, 0x40, 0xC4, 0x40, 0x0B, 0x40,
+  0xC4, 0x40, 0x00, 0xC4, 0x0D, 0xC4, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x0D, 0x40, 0x80, 0xC0,
+  0x80, 0x40, 0x3F, 0x29, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x0D, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x01,
+  0xC4, 0x0D, 0xC4, 0x00, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x80, 0xC4, 0x80, 0x0B, 0x80,
+  0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80,
+  0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81,
+  0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80,
+  0xC4, 0x80, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x00, 0x40, 0x89,
+  0x40, 0x00, 0x80, 0xC2, 0x80, 0x02, 0x40, 0x80, 0x40, 0x00, 0x80, 0xCB, 0x80, 0x00, 0x40, 0x80,
+  0x40, 0x06, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0x80, 0xCB,
+  0x80, 0x0C, 0x40, 0x89, 0x40, 0x06, 0x3F, 0x3F, 0x16, 0x40, 0x80, 0x40, 0x15, 0x80, 0xC2, 0x80,
+  0x13, 0x40, 0xC4, 0x40, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x13, 0xC4, 0x14, 0x40,
+  0x80, 0xC0, 0x80, 0x40, 0x3F, 0x3C, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x14, 0xC4, 0x13, 0x40, 0xC4,
+  0x40, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4,
+  0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4,
+  0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x13, 0x80, 0xC2, 0x80, 0x15, 0x40, 0x80,
+  0x40, 0x3F, 0x3F, 0x03, 0x06, 0x40, 0x89, 0x40, 0x0C, 0x80, 0xCB, 0x80, 0x0A, 0x40, 0xCD, 0x40,
+  0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0x80, 0xCB, 0x80, 0x00, 0x40, 0x80, 0x40,
+  0x08, 0x40, 0x89, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x13, 0x40, 0xC4, 0x40, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x40, 0xC4, 0x40, 0x13, 0xC4, 0x06, 0x40, 0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0, 0x80, 0x40,
+  0x06, 0xCD, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0xCD, 0x06, 0x40, 0x80, 0xC0,
+  0x80, 0x41, 0x80, 0xC9, 0x80, 0x40, 0x06, 0xC4, 0x13, 0x40, 0xC4, 0x40, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x40, 0xC4, 0x40, 0x13, 0x80, 0xC2, 0x80, 0x00, 0x40, 0x89, 0x40, 0x08, 0x40, 0x80, 0x40,
+  0x00, 0x80, 0xCB, 0x80, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40,
+  0x0A, 0x80, 0xCB, 0x80, 0x0C, 0x40, 0x89, 0x40, 0x06, 0x06, 0x40, 0x89, 0x40, 0x0C, 0x80, 0xCB,
+  0x80, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0x80, 0xCB,
+  0x80, 0x00, 0x40, 0x80, 0x40, 0x08, 0x40, 0x89, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x13, 0x40, 0xC4,
+  0x40, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4,
+  0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4,
+  0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x13, 0xC4, 0x06, 0x40, 0x80, 0xC9, 0x80,
+  0x41, 0x80, 0xC0, 0x80, 0x40, 0x06, 0xCD, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x40, 0xCD, 0x40, 0x0A,
+  0xCD, 0x0B, 0x40, 0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0, 0x80, 0x40, 0x14, 0xC4, 0x13, 0x40, 0xC4,
+  0x40, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4,
+  0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4,
+  0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x06, 0x40, 0x89, 0x40, 0x00, 0x80, 0xC2,
+  0x80, 0x06, 0x80, 0xCB, 0x80, 0x00, 0x40, 0x80, 0x40, 0x06, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD,
+  0x80, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0x80, 0xCB, 0x80, 0x0C, 0x40, 0x89, 0x40, 0x06, 0x3F, 0x3F,
+  0x03, 0x40, 0x80, 0x40, 0x0F, 0x40, 0x80, 0x40, 0x02, 0x80, 0xC2, 0x80, 0x0D, 0x80, 0xC2, 0x80,
+  0x00, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x80, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4,
+  0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4,
+  0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B,
+  0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x80, 0x40,
+  0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x00, 0xC4, 0x0D, 0xC4, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x41,
+  0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0, 0x80, 0x40, 0x06, 0xCD, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x40,
+  0xCD, 0x40, 0x0A, 0xCD, 0x0B, 0x40, 0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0, 0x80, 0x40, 0x14, 0xC4,
+  0x13, 0x40, 0xC4, 0x40, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x13, 0x80, 0xC2, 0x80,
+  0x15, 0x40, 0x80, 0x40, 0x3F, 0x3F, 0x03, 0x06, 0x40, 0x89, 0x40, 0x0C, 0x80, 0xCB, 0x80, 0x0A,
+  0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40, 0x06, 0x40, 0x80, 0x40, 0x00,
+  0x80, 0xCB, 0x80, 0x06, 0x80, 0xC2, 0x80, 0x00, 0x40, 0x89, 0x40, 0x06, 0x40, 0xC4, 0x40, 0x12,
+  0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12,
+  0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12,
+  0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x13, 0xC4, 0x14, 0x40, 0x80, 0xC0, 0x80, 0x41, 0x80,
+  0xC9, 0x80, 0x40, 0x0B, 0xCD, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0xCD, 0x0B,
+  0x40, 0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0, 0x80, 0x40, 0x14, 0xC4, 0x13, 0x40, 0xC4, 0x40, 0x12,
+  0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12,
+  0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12,
+  0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x06, 0x40, 0x89, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x06,
+  0x80, 0xCB, 0x80, 0x00, 0x40, 0x80, 0x40, 0x06, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09,
+  0x40, 0xCD, 0x40, 0x0A, 0x80, 0xCB, 0x80, 0x0C, 0x40, 0x89, 0x40, 0x06, 0x06, 0x40, 0x89, 0x40,
+  0x0C, 0x80, 0xCB, 0x80, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40,
+  0x06, 0x40, 0x80, 0x40, 0x00, 0x80, 0xCB, 0x80, 0x06, 0x80, 0xC2, 0x80, 0x00, 0x40, 0x89, 0x40,
+  0x06, 0x40, 0xC4, 0x40, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80,
+  0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x13, 0xC4, 0x14, 0x40,
+  0x80, 0xC0, 0x80, 0x41, 0x80, 0xC9, 0x80, 0x40, 0x0B, 0xCD, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x40,
+  0xCD, 0x40, 0x0A, 0xCD, 0x06, 0x40, 0x80, 0xC0, 0x80, 0x41, 0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0,
+  0x80, 0x40, 0x01, 0xC4, 0x0D, 0xC4, 0x00, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x80, 0xC4,
+  0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4,
+  0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B,
+  0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4,
+  0x80, 0x0B, 0x80, 0xC4, 0x80, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x00, 0x80, 0xC2, 0x80,
+  0x00, 0x40, 0x89, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x02, 0x40, 0x80, 0x40, 0x00, 0x80, 0xCB, 0x80,
+  0x00, 0x40, 0x80, 0x40, 0x06, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40,
+  0x0A, 0x80, 0xCB, 0x80, 0x0C, 0x40, 0x89, 0x40, 0x06, 0x06, 0x40, 0x89, 0x40, 0x0C, 0x80, 0xCB,
+  0x80, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0x80, 0xCB,
+  0x80, 0x00, 0x40, 0x80, 0x40, 0x08, 0x40, 0x89, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x13, 0x40, 0xC4,
+  0x40, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4,
+  0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4,
+  0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x13, 0xC4, 0x14, 0x40, 0x80, 0xC0, 0x80,
+  0x40, 0x3F, 0x3C, 0x40, 0x80, 0xC0, 0x80, 0x40, 0x14, 0xC4, 0x13, 0x40, 0xC4, 0x40, 0x12, 0x80,
+  0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80,
+  0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80,
+  0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x13, 0x80, 0xC2, 0x80, 0x15, 0x40, 0x80, 0x40, 0x3F, 0x3F,
+  0x03, 0x06, 0x40, 0x89, 0x40, 0x0C, 0x80, 0xCB, 0x80, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD,
+  0x80, 0x09, 0x40, 0xCD, 0x40, 0x06, 0x40, 0x80, 0x40, 0x00, 0x80, 0xCB, 0x80, 0x00, 0x40, 0x80,
+  0x40, 0x02, 0x80, 0xC2, 0x80, 0x00, 0x40, 0x89, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x00, 0x40, 0xC4,
+  0x40, 0x0B, 0x40, 0xC4, 0x40, 0x80, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80,
+  0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80,
+  0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81,
+  0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x80, 0x40, 0xC4, 0x40, 0x0B,
+  0x40, 0xC4, 0x40, 0x00, 0xC4, 0x0D, 0xC4, 0x01, 0x40, 0x80, 0xC0, 0x80, 0x41, 0x80, 0xC9, 0x80,
+  0x41, 0x80, 0xC0, 0x80, 0x40, 0x06, 0xCD, 0x0A, 0x40, 0xCD, 0x40, 0x09, 0x40, 0xCD, 0x40, 0x0A,
+  0xCD, 0x06, 0x40, 0x80, 0xC0, 0x80, 0x41, 0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0, 0x80, 0x40, 0x01,
+  0xC4, 0x0D, 0xC4, 0x00, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x80, 0xC4, 0x80, 0x0B, 0x80,
+  0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80,
+  0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81,
+  0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80,
+  0xC4, 0x80, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x00, 0x40, 0x89,
+  0x40, 0x00, 0x80, 0xC2, 0x80, 0x02, 0x40, 0x80, 0x40, 0x00, 0x80, 0xCB, 0x80, 0x00, 0x40, 0x80,
+  0x40, 0x06, 0x40, 0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0x80, 0xCB,
+  0x80, 0x0C, 0x40, 0x89, 0x40, 0x06, 0x06, 0x40, 0x89, 0x40, 0x0C, 0x80, 0xCB, 0x80, 0x0A, 0x40,
+  0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40, 0x06, 0x40, 0x80, 0x40, 0x00, 0x80,
+  0xCB, 0x80, 0x00, 0x40, 0x80, 0x40, 0x02, 0x80, 0xC2, 0x80, 0x00, 0x40, 0x89, 0x40, 0x00, 0x80,
+  0xC2, 0x80, 0x00, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x80, 0xC4, 0x80, 0x0B, 0x80, 0xC4,
+  0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B,
+  0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4,
+  0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4, 0x81, 0xC4, 0x80, 0x0B, 0x80, 0xC4,
+  0x80, 0x40, 0xC4, 0x40, 0x0B, 0x40, 0xC4, 0x40, 0x00, 0xC4, 0x0D, 0xC4, 0x01, 0x40, 0x80, 0xC0,
+  0x80, 0x41, 0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0, 0x80, 0x40, 0x06, 0xCD, 0x0A, 0x40, 0xCD, 0x40,
+  0x09, 0x40, 0xCD, 0x40, 0x0A, 0xCD, 0x0B, 0x40, 0x80, 0xC9, 0x80, 0x41, 0x80, 0xC0, 0x80, 0x40,
+  0x14, 0xC4, 0x13, 0x40, 0xC4, 0x40, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80,
+  0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80,
+  0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x80, 0xC4, 0x80, 0x12, 0x40, 0xC4, 0x40, 0x06, 0x40,
+  0x89, 0x40, 0x00, 0x80, 0xC2, 0x80, 0x06, 0x80, 0xCB, 0x80, 0x00, 0x40, 0x80, 0x40, 0x06, 0x40,
+  0xCD, 0x40, 0x09, 0x80, 0xCD, 0x80, 0x09, 0x40, 0xCD, 0x40, 0x0A, 0x80, 0xCB, 0x80, 0x0C, 0x40,
+  0x89, 0x40, 0x06, 0x3F, 0x30, 0x80, 0xC1, 0x80, 0x04, 0x80, 0xC3, 0x80, 0x03, 0xC5, 0x03, 0xC5,
+  0x03, 0x80, 0xC3, 0x80, 0x04, 0x80, 0xC1, 0x80, 0x3F, 0x29, 0x80, 0xC1, 0x80, 0x04, 0x80, 0xC3,
+  0x80, 0x03, 0xC5, 0x03, 0xC5, 0x03, 0x80, 0xC3, 0x80, 0x04, 0x80, 0xC1, 0x80, 0x3F, 0x30,
+};
+
+const AtlasGlyph timerAtlasGlyphs[] = {
+  { '0', 26, 0, 262 },
+  { '1', 26, 262, 126 },
+  { '2', 26, 388, 197 },
+  { '3', 26, 585, 197 },
+  { '4', 26, 782, 185 },
+  { '5', 26, 967, 197 },
+  { '6', 26, 1164, 237 },
+  { '7', 26, 1401, 152 },
+  { '8', 26, 1553, 277 },
+  { '9', 26, 1830, 237 },
+  { ':', 10, 2067, 44 },
+};
+
+const AtlasFont timerAtlas = { timerAtlasGlyphs, 11, 44, 4, timerAtlasData };
+
+// clock: 10x18, 14 glyphs, 889 RLE bytes (4824 bytes as RGB565)
+const uint8_t clockAtlasData[] PROGMEM = {
+  0x02, 0x40, 0x81, 0x40, 0x04, 0x40, 0xC3, 0x40, 0x02, 0x40, 0x80, 0xC3, 0x80, 0x40, 0x00, 0x40,
+  0xC1, 0x03, 0xC1, 0x40, 0x80, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1,
+  0x80, 0x40, 0xC1, 0x03, 0xC1, 0x40, 0x00, 0x40, 0x05, 0x40, 0x01, 0x40, 0x05, 0x40, 0x00, 0x40,
+  0xC1, 0x03, 0xC1, 0x40, 0x80, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1,
+  0x80, 0x40, 0xC1, 0x03, 0xC1, 0x40, 0x00, 0x40, 0x80, 0xC3, 0x80, 0x40, 0x02, 0x40, 0xC3, 0x40,
+  0x04, 0x40, 0x81, 0x40, 0x02, 0x1A, 0x41, 0x07, 0xC1, 0x40, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80,
+  0x06, 0xC1, 0x80, 0x06, 0xC1, 0x40, 0x07, 0x40, 0x08, 0x40, 0x07, 0xC1, 0x40, 0x06, 0xC1, 0x80,
+  0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x40, 0x06, 0x41, 0x14, 0x02, 0x40, 0x81, 0x40,
+  0x04, 0x40, 0xC3, 0x40, 0x03, 0x40, 0xC3, 0x80, 0x40, 0x07, 0xC1, 0x40, 0x06, 0xC1, 0x80, 0x06,
+  0xC1, 0x80, 0x06, 0xC1, 0x80, 0x02, 0x43, 0xC1, 0x40, 0x01, 0x40, 0xC3, 0x41, 0x01, 0x41, 0xC3,
+  0x40, 0x01, 0x40, 0xC1, 0x43, 0x02, 0x80, 0xC1, 0x06, 0x80, 0xC1, 0x06, 0x80, 0xC1, 0x06, 0x40,
+  0xC1, 0x07, 0x40, 0x80, 0xC3, 0x40, 0x03, 0x40, 0xC3, 0x40, 0x04, 0x40, 0x81, 0x40, 0x02, 0x02,
+  0x40, 0x81, 0x40, 0x04, 0x40, 0xC3, 0x40, 0x03, 0x40, 0xC3, 0x80, 0x40, 0x07, 0xC1, 0x40, 0x06,
+  0xC1, 0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80, 0x02, 0x43, 0xC1, 0x40, 0x01, 0x40, 0xC3, 0x41,
+  0x02, 0x40, 0xC3, 0x41, 0x03, 0x43, 0xC1, 0x40, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1,
+  0x80, 0x06, 0xC1, 0x40, 0x01, 0x40, 0xC3, 0x80, 0x40, 0x02, 0x40, 0xC3, 0x40, 0x04, 0x40, 0x81,
+  0x40, 0x02, 0x14, 0x41, 0x03, 0x41, 0x00, 0x40, 0xC1, 0x03, 0xC1, 0x40, 0x80, 0xC1, 0x03, 0xC1,
+  0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x80, 0x40, 0xC1, 0x43, 0xC1, 0x40, 0x00, 0x41,
+  0xC3, 0x41, 0x02, 0x40, 0xC3, 0x41, 0x03, 0x43, 0xC1, 0x40, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80,
+  0x06, 0xC1, 0x80, 0x06, 0xC1, 0x40, 0x06, 0x41, 0x14, 0x02, 0x40, 0x81, 0x40, 0x04, 0x40, 0xC3,
+  0x40, 0x02, 0x40, 0x80, 0xC3, 0x40, 0x01, 0x40, 0xC1, 0x06, 0x80, 0xC1, 0x06, 0x80, 0xC1, 0x06,
+  0x80, 0xC1, 0x06, 0x40, 0xC1, 0x43, 0x03, 0x41, 0xC3, 0x40, 0x03, 0x40, 0xC3, 0x41, 0x03, 0x43,
+  0xC1, 0x40, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x40, 0x01, 0x40,
+  0xC3, 0x80, 0x40, 0x02, 0x40, 0xC3, 0x40, 0x04, 0x40, 0x81, 0x40, 0x02, 0x02, 0x40, 0x81, 0x40,
+  0x04, 0x40, 0xC3, 0x40, 0x02, 0x40, 0x80, 0xC3, 0x40, 0x01, 0x40, 0xC1, 0x06, 0x80, 0xC1, 0x06,
+  0x80, 0xC1, 0x06, 0x80, 0xC1, 0x06, 0x40, 0xC1, 0x43, 0x03, 0x41, 0xC3, 0x40, 0x02, 0x41, 0xC3,
+  0x41, 0x00, 0x40, 0xC1, 0x43, 0xC1, 0x40, 0x80, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81,
+  0xC1, 0x03, 0xC1, 0x80, 0x40, 0xC1, 0x03, 0xC1, 0x40, 0x00, 0x40, 0x80, 0xC3, 0x80, 0x40, 0x02,
+  0x40, 0xC3, 0x40, 0x04, 0x40, 0x81, 0x40, 0x02, 0x02, 0x40, 0x81, 0x40, 0x04, 0x40, 0xC3, 0x40,
+  0x03, 0x40, 0xC3, 0x80, 0x40, 0x07, 0xC1, 0x40, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1,
+  0x80, 0x06, 0xC1, 0x40, 0x07, 0x40, 0x08, 0x40, 0x07, 0xC1, 0x40, 0x06, 0xC1, 0x80, 0x06, 0xC1,
+  0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x40, 0x06, 0x41, 0x14, 0x02, 0x40, 0x81, 0x40, 0x04, 0x40,
+  0xC3, 0x40, 0x02, 0x40, 0x80, 0xC3, 0x80, 0x40, 0x00, 0x40, 0xC1, 0x03, 0xC1, 0x40, 0x80, 0xC1,
+  0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x80, 0x40, 0xC1, 0x43, 0xC1, 0x40,
+  0x00, 0x41, 0xC3, 0x41, 0x01, 0x41, 0xC3, 0x41, 0x00, 0x40, 0xC1, 0x43, 0xC1, 0x40, 0x80, 0xC1,
+  0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x80, 0x40, 0xC1, 0x03, 0xC1, 0x40,
+  0x00, 0x40, 0x80, 0xC3, 0x80, 0x40, 0x02, 0x40, 0xC3, 0x40, 0x04, 0x40, 0x81, 0x40, 0x02, 0x02,
+  0x40, 0x81, 0x40, 0x04, 0x40, 0xC3, 0x40, 0x02, 0x40, 0x80, 0xC3, 0x80, 0x40, 0x00, 0x40, 0xC1,
+  0x03, 0xC1, 0x40, 0x80, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x80,
+  0x40, 0xC1, 0x43, 0xC1, 0x40, 0x00, 0x41, 0xC3, 0x41, 0x02, 0x40, 0xC3, 0x41, 0x03, 0x43, 0xC1,
+  0x40, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x80, 0x06, 0xC1, 0x40, 0x01, 0x40, 0xC3,
+  0x80, 0x40, 0x02, 0x40, 0xC3, 0x40, 0x04, 0x40, 0x81, 0x40, 0x02, 0x10, 0x41, 0x00, 0x40, 0xC1,
+  0x40, 0x00, 0xC1, 0x11, 0xC1, 0x00, 0x40, 0xC1, 0x40, 0x00, 0x41, 0x10, 0x02, 0x40, 0x81, 0x40,
+  0x04, 0x40, 0xC3, 0x40, 0x02, 0x40, 0x80, 0xC3, 0x80, 0x40, 0x00, 0x40, 0xC1, 0x03, 0xC1, 0x40,
+  0x80, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x80, 0x40, 0xC1, 0x43,
+  0xC1, 0x40, 0x00, 0x41, 0xC3, 0x41, 0x01, 0x41, 0xC3, 0x41, 0x00, 0x40, 0xC1, 0x43, 0xC1, 0x40,
+  0x80, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x80, 0x40, 0xC1, 0x03,
+  0xC1, 0x40, 0x00, 0x41, 0x03, 0x41, 0x14, 0x02, 0x40, 0x81, 0x40, 0x04, 0x40, 0xC3, 0x40, 0x02,
+  0x40, 0x80, 0xC3, 0x80, 0x40, 0x00, 0x40, 0xC1, 0x03, 0xC1, 0x40, 0x80, 0xC1, 0x03, 0xC1, 0x81,
+  0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x80, 0x40, 0xC1, 0x43, 0xC1, 0x40, 0x00, 0x41, 0xC3,
+  0x41, 0x01, 0x41, 0xC3, 0x40, 0x01, 0x40, 0xC1, 0x43, 0x02, 0x80, 0xC1, 0x06, 0x80, 0xC1, 0x06,
+  0x80, 0xC1, 0x06, 0x40, 0xC1, 0x07, 0x41, 0x1A, 0x14, 0x41, 0x03, 0x41, 0x00, 0x40, 0xC1, 0x40,
+  0x01, 0x40, 0xC1, 0x40, 0x80, 0xC1, 0x80, 0x01, 0x80, 0xC1, 0x81, 0xC2, 0x81, 0xC2, 0x81, 0xC7,
+  0x81, 0xC7, 0x81, 0xC1, 0x40, 0xC1, 0x40, 0xC1, 0x81, 0xC1, 0x00, 0x41, 0x00, 0xC1, 0x81, 0xC1,
+  0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x81, 0xC1, 0x03, 0xC1, 0x80, 0x40,
+  0xC1, 0x03, 0xC1, 0x40, 0x00, 0x41, 0x03, 0x41, 0x14,
+};
+
+const AtlasGlyph clockAtlasGlyphs[] = {
+  { '0', 10, 0, 85 },
+  { '1', 10, 85, 39 },
+  { '2', 10, 124, 67 },
+  { '3', 10, 191, 67 },
+  { '4', 10, 258, 55 },
+  { '5', 10, 313, 67 },
+  { '6', 10, 380, 76 },
+  { '7', 10, 456, 50 },
+  { '8', 10, 506, 85 },
+  { '9', 10, 591, 76 },
+  { ':', 4, 667, 17 },
+  { 'A', 10, 684, 75 },
+  { 'P', 10, 759, 65 },
+  { 'M', 10, 824, 65 },
+};
+
+const AtlasFont clockAtlas = { clockAtlasGlyphs, 14, 18, 2, clockAtlasData };
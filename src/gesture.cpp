@@ -0,0 +1,88 @@
+#include "gesture.h"
+
+static const char* const GESTURE_NAMES[] = {
+  "none", "tap", "double-tap", "long-press",
+  "swipe-left", "swipe-right", "swipe-up", "swipe-down", "swipe",
+};
+
+const char* gestureName(GestureType type) {
+  return type <= GESTURE_SWIPE_ANY ? GESTURE_NAMES[type] : "?";
+}
+
+static bool isSwipe(GestureType type) {
+  return type >= GESTURE_SWIPE_LEFT && type <= GESTURE_SWIPE_ANY;
+}
+
+GestureType GestureClassifier::swipeDirection(int dx, int dy) const {
+  if (abs(dx) >= abs(dy)) {
+    return dx < 0 ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+  }
+  return dy < 0 ? GESTURE_SWIPE_UP : GESTURE_SWIPE_DOWN;
+}
+
+GestureType GestureClassifier::update(bool touched, int x, int y, uint32_t ms, GestureType hint) {
+  if (hint != GESTURE_NONE) {
+    hint_ = hint;
+  }
+
+  if (touched) {
+    if (!down_) {
+      // New stroke; a hint read now may still describe the previous one
+      down_ = true;
+      reported_ = false;
+      hint_ = GESTURE_NONE;
+      startX_ = lastX_ = x;
+      startY_ = lastY_ = y;
+      startMs_ = ms;
+      return GESTURE_NONE;
+    }
+
+    lastX_ = x;
+    lastY_ = y;
+    bool still = abs(x - startX_) <= GESTURE_TAP_SLOP_PX && abs(y - startY_) <= GESTURE_TAP_SLOP_PX;
+    if (!reported_ && (hint_ == GESTURE_LONG_PRESS || (still && ms - startMs_ >= GESTURE_LONG_PRESS_MS))) {
+      reported_ = true;
+      tapPending_ = false;
+      return GESTURE_LONG_PRESS;
+    }
+    return GESTURE_NONE;
+  }
+
+  if (!down_) {
+    return GESTURE_NONE;
+  }
+  down_ = false;
+  if (reported_) {
+    return GESTURE_NONE;  // Release after a long press
+  }
+
+  // The release sample has no position on either controller, so the
+  // stroke is measured from its first to its last touched sample
+  int dx = lastX_ - startX_;
+  int dy = lastY_ - startY_;
+  int travel = max(abs(dx), abs(dy));
+
+  // A controller swipe verdict is trusted at half the travel, but the
+  // direction always comes from the mapped coordinates so it follows the
+  // screen rotation rather than the controller's native orientation
+  if (travel >= GESTURE_SWIPE_MIN_PX || (isSwipe(hint_) && travel >= GESTURE_SWIPE_MIN_PX / 2)) {
+    tapPending_ = false;
+    return swipeDirection(dx, dy);
+  }
+  if (isSwipe(hint_) || (travel > GESTURE_TAP_SLOP_PX && hint_ == GESTURE_NONE)) {
+    tapPending_ = false;
+    return GESTURE_NONE;  // A short drag is neither a tap nor a swipe
+  }
+
+  if (hint_ == GESTURE_DOUBLE_TAP ||
+      (tapPending_ && ms - tapMs_ <= GESTURE_DOUBLE_TAP_MS &&
+       abs(startX_ - tapX_) <= 2 * GESTURE_TAP_SLOP_PX && abs(startY_ - tapY_) <= 2 * GESTURE_TAP_SLOP_PX)) {
+    tapPending_ = false;
+    return GESTURE_DOUBLE_TAP;
+  }
+  tapPending_ = true;
+  tapX_ = startX_;
+  tapY_ = startY_;
+  tapMs_ = ms;
+  return GESTURE_TAP;
+}
@@ -0,0 +1,59 @@
+#pragma once
+// ===== GESTURE CLASSIFIER =====
+// Turns the point stream of one finger into tap, double-tap, long-press and
+// swipe events. The touch task feeds it one sample per read, so it works
+// the same for the XPT2046 (which only reports points) and the CST816S
+// (whose own gesture verdict can be passed in as a hint).
+
+#include <Arduino.h>
+
+enum GestureType : uint8_t {
+  GESTURE_NONE,
+  GESTURE_TAP,
+  GESTURE_DOUBLE_TAP,   // Second tap near the first within GESTURE_DOUBLE_TAP_MS
+  GESTURE_LONG_PRESS,   // Reported while the finger is still down
+  GESTURE_SWIPE_LEFT,
+  GESTURE_SWIPE_RIGHT,
+  GESTURE_SWIPE_UP,
+  GESTURE_SWIPE_DOWN,
+  GESTURE_SWIPE_ANY,    // Hint only: a swipe, direction left to the classifier
+};
+
+// A classified gesture on its way to the timer state machine
+struct TouchEvent {
+  GestureType gesture;
+  int16_t x, y;       // Where the stroke started
+  int64_t irqMicros;  // Time of the interrupt (or sample) that started the stroke
+};
+
+const int GESTURE_TAP_SLOP_PX = 12;         // Movement still counted as a tap
+const int GESTURE_SWIPE_MIN_PX = 50;        // Travel that makes a swipe
+const uint32_t GESTURE_LONG_PRESS_MS = 800;
+const uint32_t GESTURE_DOUBLE_TAP_MS = 350;
+
+const char* gestureName(GestureType type);
+
+class GestureClassifier {
+public:
+  // One sample per read; touched=false is the release. hint is the
+  // controller's own verdict for this stroke, GESTURE_NONE if it has none.
+  // Returns the gesture completed by this sample, at most one per stroke.
+  GestureType update(bool touched, int x, int y, uint32_t ms, GestureType hint = GESTURE_NONE);
+
+  // Where the current (or last) stroke started
+  int startX() const { return startX_; }
+  int startY() const { return startY_; }
+
+private:
+  GestureType swipeDirection(int dx, int dy) const;
+
+  bool down_ = false;
+  bool reported_ = false;           // Long press already sent for this stroke
+  GestureType hint_ = GESTURE_NONE;
+  int startX_ = 0, startY_ = 0;
+  int lastX_ = 0, lastY_ = 0;
+  uint32_t startMs_ = 0;
+  bool tapPending_ = false;         // Last stroke was a tap that may be doubled
+  int tapX_ = 0, tapY_ = 0;
+  uint32_t tapMs_ = 0;
+};
@@ -0,0 +1,81 @@
+#include "ima_adpcm.h"
+#include <string.h>
+
+static const int8_t INDEX_TABLE[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static const int16_t STEP_TABLE[89] = {
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+  34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+  157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+  724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+  3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+};
+
+static uint16_t read16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+static uint32_t read32(const uint8_t* p) { return read16(p) | ((uint32_t)read16(p + 2) << 16); }
+
+bool imaParseWav(const uint8_t* data, uint32_t size, ImaWavInfo &info) {
+  if (size < 12 || memcmp(data, "RIFF", 4) != 0 || memcmp(data + 8, "WAVE", 4) != 0) {
+    return false;
+  }
+  memset(&info, 0, sizeof(info));
+  bool haveFmt = false;
+  uint32_t pos = 12;
+  while (pos + 8 <= size) {
+    const uint8_t* chunk = data + pos;
+    uint32_t chunkSize = read32(chunk + 4);
+    const uint8_t* body = chunk + 8;
+    if (memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= 20 && pos + 8 + 20 <= size) {
+      uint16_t format = read16(body);
+      uint16_t channels = read16(body + 2);
+      uint16_t bits = read16(body + 14);
+      if (format != 0x0011 || channels != 1 || bits != 4) {
+        return false;
+      }
+      info.sampleRate = read32(body + 4);
+      info.blockAlign = read16(body + 12);
+      info.samplesPerBlock = read16(body + 18);
+      haveFmt = true;
+    } else if (memcmp(chunk, "fact", 4) == 0 && chunkSize >= 4 && pos + 12 <= size) {
+      info.sampleCount = read32(body);
+    } else if (memcmp(chunk, "data", 4) == 0) {
+      info.dataOffset = pos + 8;
+      info.dataSize = chunkSize;
+      break;
+    }
+    pos += 8 + chunkSize + (chunkSize & 1);
+  }
+  return haveFmt && info.dataOffset != 0 && info.blockAlign > 4 &&
+         info.blockAlign <= IMA_MAX_BLOCK_ALIGN &&
+         info.samplesPerBlock == (info.blockAlign - 4) * 2 + 1;
+}
+
+int imaDecodeBlock(const uint8_t* block, int size, int16_t* out) {
+  if (size < 4 || size > IMA_MAX_BLOCK_ALIGN || block[2] > 88) {
+    return 0;
+  }
+  int predictor = (int16_t)read16(block);
+  int index = block[2];
+  int count = 0;
+  out[count++] = predictor;
+
+  for (int i = 4; i < size; i++) {
+    for (int shift = 0; shift <= 4; shift += 4) {
+      int nibble = (block[i] >> shift) & 0x0F;
+      int step = STEP_TABLE[index];
+      int delta = step >> 3;
+      if (nibble & 4) delta += step;
+      if (nibble & 2) delta += step >> 1;
+      if (nibble & 1) delta += step >> 2;
+      predictor += (nibble & 8) ? -delta : delta;
+      if (predictor > 32767) predictor = 32767;
+      if (predictor < -32768) predictor = -32768;
+      index += INDEX_TABLE[nibble];
+      if (index < 0) index = 0;
+      if (index > 88) index = 88;
+      out[count++] = predictor;
+    }
+  }
+  return count;
+}
@@ -0,0 +1,30 @@
+#pragma once
+// ===== IMA-ADPCM DECODER =====
+// Decodes the mono WAVE_FORMAT_IMA_ADPCM (0x0011) data written by
+// tools/gen_sound_adpcm.py. Each block starts with a 4-byte header (the
+// first sample and the step index) followed by two 4-bit codes per byte,
+// low nibble first. Free of audio library code so the host can decode too.
+
+#include <Arduino.h>
+
+const int IMA_MAX_BLOCK_ALIGN = 512;     // Largest block the decoder buffers
+const int IMA_MAX_BLOCK_SAMPLES = (IMA_MAX_BLOCK_ALIGN - 4) * 2 + 1;
+
+// What the RIFF header says about the ADPCM data
+struct ImaWavInfo {
+  uint32_t sampleRate;
+  uint16_t blockAlign;        // Bytes per block, header included
+  uint16_t samplesPerBlock;
+  uint32_t dataOffset;        // Of the first block, from the start of the file
+  uint32_t dataSize;
+  uint32_t sampleCount;       // From the fact chunk; 0 if absent
+};
+
+// Parse the RIFF header at the start of 'data' ('size' bytes available).
+// False unless it is mono IMA-ADPCM with a block size the decoder takes.
+bool imaParseWav(const uint8_t* data, uint32_t size, ImaWavInfo &info);
+
+// Decode one block of 'size' bytes (a short final block is allowed) into
+// 'out'. Returns the number of samples written: (size - 4) * 2 + 1, or 0
+// if the block is malformed.
+int imaDecodeBlock(const uint8_t* block, int size, int16_t* out);
@@ -7,14 +7,30 @@
 #include <Preferences.h>
 #include <WiFi.h>
 #include <time.h>
+#include <esp_timer.h>
+#include <driver/dac.h>
+#include <esp_heap_caps.h>
 
 // ESP8266Audio library for WAV playback
-#include "AudioFileSourcePROGMEM.h"
-#include "AudioGeneratorWAV.h"
 #include "AudioOutputI2S.h"
-
-// WAV file data in PROGMEM
-#include "happy-chimes.h"
+#include "audio_adpcm.h"
+#include "audio_file_stream.h"
+#include "audio_ring_output.h"
+#include "audio_bell.h"
+#include "audio_mixer.h"
+#include "audio_health.h"
+#include "alarm_schedule.h"
+#include "sounds.h"
+
+// Retained widgets, the dirty-rect compositor and the screens built from them
+#include "ui.h"
+#include "screens.h"
+#include "profiler.h"
+#include "gesture.h"
+#include "touch_cal.h"
+#include "tap_bench.h"
+#include "timer_app.h"
+#include "touch_trace.h"
 
 // ===== BOARD-SPECIFIC CONFIGURATION =====
 #if defined(BOARD_CYD_RESISTIVE)
@@ -32,15 +48,18 @@
   #define BOARD_NAME "ESP32-2432S028R (Resistive)"
   #define SPEAKER_EN_PIN 4  // Speaker amplifier enable (active LOW)
   
-  // Touch calibration values (adjust for your specific board)
+  // Default touch calibration (until the calibration wizard has been run)
   #define TOUCH_MIN_X 300
   #define TOUCH_MAX_X 3900
   #define TOUCH_MIN_Y 300
   #define TOUCH_MAX_Y 3900
+  #define TOUCH_Z_MIN 500          // Pressure below this is not a touch (library uses 400)
+  #define TOUCH_BURST_SPACING_MS 4 // The library re-reads the panel at most every 3 ms
   
   // Create second SPI bus for touch
+  // (TOUCH_IRQ is handled by our own ISR, so the library doesn't get it)
   SPIClass touchSPI(HSPI);
-  XPT2046_Touchscreen ts(TOUCH_CS, TOUCH_IRQ);
+  XPT2046_Touchscreen ts(TOUCH_CS);
 
 #elif defined(BOARD_CYD_CAPACITIVE)
   // JC2432W328C (Guition) with CST816S Capacitive Touch (I2C)
@@ -52,6 +71,11 @@
   #define TOUCH_RST 25
   #define TFT_BACKLIGHT 27
   #define CST816S_ADDR 0x15
+  #define CST816S_REG_IRQ_CTL 0xFA  // Interrupt control
+  #define CST816S_IRQ_EN_TOUCH 0x40 // Pulse INT periodically while touched
+  #define CST816S_IRQ_EN_CHANGE 0x20 // Pulse INT when the touch state changes
+  #define CST816S_IRQ_EN_MOTION 0x10 // Pulse INT when a gesture is recognised
+  #define CST816S_REG_GESTURE 0x01   // Gesture ID, followed by 0x02-0x06 point data
   #define BOARD_NAME "JC2432W328C (Capacitive)"
   #define SPEAKER_EN_PIN 4  // Speaker amplifier enable (active LOW)
 
@@ -73,75 +97,306 @@ const int DAYLIGHT_OFFSET_SEC = 0;      // Set to 3600 if DST is active
 const int THRESHOLD_YELLOW = 12600;  // 3.5 hours (210 minutes)
 const int THRESHOLD_BLUE = 14400;   // 4 hours (240 minutes)
 
-// Touch debounce delay (in milliseconds)
-const unsigned long TOUCH_DEBOUNCE_MS = 500;  
+// Alarms: a warning at yellow, then a bell at blue, repeated and louder
+// each time until a tap resets the timer
+const uint32_t ALARM_REPEAT_SECONDS = 600;  // 10 minutes between bells
+const uint8_t ALARM_MAX_BELLS = 6;          // Then quiet until the next reset
+const float ALARM_FIRST_GAIN = 0.5f;        // Voice gain of the warning and first bell...
+const float ALARM_LAST_GAIN = 1.0f;         // ...ramped up to this on the last bell
+
 
 // ===== GLOBAL OBJECTS =====
 TFT_eSPI tft = TFT_eSPI();
 
-// Audio objects for WAV playback
-AudioGeneratorWAV *wav = nullptr;
-AudioFileSourcePROGMEM *audioFile = nullptr;
+// Audio objects for playback (audio task only, see AUDIO TASK). The
+// generators live in static storage and are restarted for each play, and
+// sound files stream through a read-ahead allocated once at boot (see
+// SOUND FILES), so a sound never touches the heap.
+AudioGeneratorImaAdpcm fileGenerator;      // One sound file at a time, on any voice
 AudioOutputI2S *audioOut = nullptr;
-bool audioPlaying = false;
-bool chimePlayedThisSession = false;  // Track if chime already played for this timer session
+int dacRate = 0;                           // Rate audioOut was last started at
+bool audioPlaying = false;                 // The DAC is running
 
-Preferences preferences;
+// GPIO25 is DAC channel 1 as well as the touch SCLK (resistive board) or
+// the touch reset line (capacitive board). Touch owns it; the I2S driver
+// enables both DAC channels when audio starts, so the pin is taken back
+// right after (see claimGpio25ForTouch()).
+uint32_t gpio25Reclaims = 0;  // Times audio start had to give GPIO25 back
 
-// ===== COLOR DEFINITIONS =====
-#define COLOR_RED     0xF800
-#define COLOR_YELLOW  0xFFE0
-#define COLOR_GREEN   0x07E0
-#define COLOR_BLUE    0x001F
-#define COLOR_WHITE   0xFFFF
-#define COLOR_BLACK   0x0000
+Preferences preferences;
 
 // ===== STATE VARIABLES =====
-enum TimerState {
-  WAITING_TO_START,
-  RUNNING,
-  VIEWING_LOGS
+// (Timer state lives in timer_app.cpp)
+bool wifiConnected = false;
+
+// Screens are composited on the render task only
+Compositor compositor;
+const Screen* shownScreen = nullptr;  // Screen the compositor last drew (render task only)
+
+// SPI traffic accounting for timer ticks (RGB565 = 2 bytes per pixel)
+const int SPI_STATS_LOG_TICKS = 60;  // Print stats every N timer ticks
+const uint32_t LEGACY_TIMER_TEXT_PIXELS = 8 * 24 * 32;  // "hh:mm:ss" in 8x scaled GLCD cells
+uint32_t timerTicksSinceLog = 0;
+
+// ===== RENDER TASK =====
+// All TFT drawing happens on a dedicated task pinned to core 0 (the Arduino
+// loop runs on core 1). loop() and handleTouchAt() only post commands.
+enum RenderCmdType : uint8_t {
+  RENDER_WAITING,  // Full waiting screen
+  RENDER_TIMER,    // Running screen for 'seconds'
+  RENDER_CLOCK,    // New clock 'text', shown if the current screen has the clock
+  RENDER_LOGS,     // Logs screen, reloaded from the log file
+  RENDER_PROFILE,  // Print the draw profile ('seconds' != 0: then reset it)
+  RENDER_CALIBRATE // Calibration target 'seconds' (CALIBRATION_POINTS: done, redraw)
 };
 
-TimerState currentState = WAITING_TO_START;
-TimerState stateBeforeLogs = WAITING_TO_START;  // Track state to return to after logs
-unsigned long timerStartMillis = 0;
-unsigned long lastTouchMillis = 0;
-unsigned long lastUpdateMillis = 0;
-int lastDisplayedSeconds = -1;
-uint16_t lastBgColor = COLOR_RED;
-bool wifiConnected = false;
-String lastClockStr = "";
+struct RenderCmd {
+  RenderCmdType type;
+  unsigned long seconds;
+  char text[12];  // RENDER_CLOCK only
+};
+
+const int RENDER_QUEUE_LEN = 8;
+const int RENDER_TASK_CORE = 0;
+const int RENDER_TASK_STACK = 6144;
+QueueHandle_t renderQueue = nullptr;
+TaskHandle_t renderTaskHandle = nullptr;
+
+volatile bool renderBusy = false;      // Render task is drawing or a DMA frame is in flight
+volatile uint32_t renderFrames = 0;    // Commands rendered
+volatile uint32_t renderDropped = 0;   // Commands dropped because the queue was full
+
+// ===== AUDIO TASK =====
+// Decoding and feeding the DAC happen on their own task on core 0, above
+// the render task's priority, so nothing the loop or the renderer does
+// (full-screen fills, LittleFS writes, log parsing) can hold up the I2S
+// feed. Each sound plays on a mixer voice: its generator decodes into the
+// voice's ring, the mixer sums the voices into audioRing, and each pass
+// moves as much of that as the I2S DMA queue takes. With nothing playing
+// the task sleeps on its request queue.
+const int AUDIO_QUEUE_LEN = 4;
+const int AUDIO_TASK_CORE = 0;
+const int AUDIO_TASK_PRIORITY = 5;          // Above render (1), below the WiFi stack
+const int AUDIO_TASK_STACK = 4096;
+const TickType_t AUDIO_TASK_PERIOD_MS = 5;  // Refill interval while playing
+const int AUDIO_DMA_BUFFERS = 8;            // AudioOutputI2S DMA descriptors (its dma_buf_count)...
+const int AUDIO_DMA_BUFFER_FRAMES = 128;    // ...of this many frames, its fixed dma_buf_len (46 ms at 22.05 kHz)
+const int AUDIO_RETRIGGER_FADE_MS = 5;      // Ramp on what a voice has queued when it is cut short
+const uint32_t AUDIO_RING_SAMPLES = 1024;   // Mixed, ahead of the DMA queue (46 ms at 22.05 kHz)
+QueueHandle_t audioQueue = nullptr;         // AudioRequests
+TaskHandle_t audioTaskHandle = nullptr;
+int16_t audioRingSamples[AUDIO_RING_SAMPLES];
+PcmRing audioRing(audioRingSamples, AUDIO_RING_SAMPLES);
+AudioMixer audioMixer;
+
+const int SOUND_NAME_MAX = 32;  // Longest sound file name, without SOUND_DIR
+
+struct AudioRequest {
+  SoundId sound;
+  float gain;                 // Voice gain (AudioOutput::SetGain)
+  char file[SOUND_NAME_MAX];  // Sound file in SOUND_DIR to play instead; empty: the synth
+};
+
+// A mixer voice: the output its generator decodes into, its own bell
+// generator, and what it is playing
+struct AudioVoice {
+  AudioOutputRing out;
+  AudioGeneratorBell bell;
+  AudioGenerator* generator = nullptr;  // bell or fileGenerator; nullptr when free
+  SoundId sound = SOUND_COUNT;
+  uint32_t startOrder = 0;              // Oldest gives way when all voices are busy
+};
+static_assert(MIXER_VOICES == 3, "one initializer per mixer voice");
+AudioVoice audioVoices[MIXER_VOICES] = {
+  { AudioOutputRing(audioMixer.voice(0)) },
+  { AudioOutputRing(audioMixer.voice(1)) },
+  { AudioOutputRing(audioMixer.voice(2)) },
+};
+uint32_t audioStarts = 0;
+
+AudioHealth audioHealth;                   // Pipeline counters since boot (audio task only)...
+AudioHealth audioHealthShared;             // ...copied here once per pass, under audioHealthLock,
+portMUX_TYPE audioHealthLock = portMUX_INITIALIZER_UNLOCKED;  // for readAudioHealth()
+
+struct MixerStats {
+  uint32_t micros = 0;                     // Time in AudioMixer::mix()
+  uint32_t samples = 0;                    // Samples it mixed in that time
+  uint8_t voicesPeak = 0;                  // Most voices playing at once
+};
+MixerStats mixerStats;                     // This pass (audio task only)...
+MixerStats mixerStatsShared;               // ...added here with the health copy, taken by takeMixerStats()
+
+// ===== SOUND FILES =====
+// The time-to-go alert can be a sound file in SOUND_DIR (made by
+// tools/gen_sound_adpcm.py, uploaded with `pio run -t uploadfs`) instead
+// of the synthesized bell. The choice ('f' on the serial console) is kept
+// in Preferences. Files stream through soundFile, whose loader task reads
+// them ahead from LittleFS: a log write holding flash up stalls the
+// loader, not the audio task. The loader's worst read and how low the
+// read-ahead ran are printed with the minute stats, and by the 'w' flash
+// stress test.
+const char* SOUND_DIR = "/sounds";
+const char* ALERT_SOUND_KEY = "alertSound";            // Preferences: file name; absent or empty: the bell
+const uint32_t SOUND_READAHEAD_BYTES = 4096;           // 8 ADPCM blocks, 370 ms at 22.05 kHz
+const int SOUND_LOADER_PRIORITY = 3;                   // Below audio, above render
+const int SOUND_LOADER_STACK = 4096;
+const unsigned long SOUND_FILE_START_TIMEOUT_MS = 500; // Wait for the read-ahead, then play the bell
+AudioFileSourceReadAhead soundFile(SOUND_READAHEAD_BYTES);
+char alertSound[SOUND_NAME_MAX] = "";  // Chosen file; the loop writes it under alertSoundLock
+portMUX_TYPE alertSoundLock = portMUX_INITIALIZER_UNLOCKED;  // Alarms read it on the esp_timer task
+int fileVoice = -1;                    // Voice waiting for soundFile to fill (audio task only)
+unsigned long fileVoiceSince = 0;
+
+// Flash stress test ('w'): the alert file plays while the loop appends a
+// log-sized line every FLASH_STRESS_INTERVAL_MS, the way logEntry() does
+const unsigned long FLASH_STRESS_MS = 3000;
+const unsigned long FLASH_STRESS_INTERVAL_MS = 20;
+const char* FLASH_STRESS_PATH = "/stress.txt";
+unsigned long flashStressUntil = 0;     // millis() the test ends at; 0 when not running
+
+// ===== TOUCH TASK =====
+// The controller's interrupt line (TOUCH_INT on the capacitive board,
+// TOUCH_IRQ on the resistive one) wakes a task through a queue. Only then
+// is the controller read, and the finger followed until release; with no
+// touch there is no bus traffic at all. Each read goes through a
+// TouchPipeline (gesture classifier) and the resulting gestures go to the
+// loop, which owns the timer state, through a second queue.
+
+const int TOUCH_IRQ_QUEUE_LEN = 4;
+const int TOUCH_EVENT_QUEUE_LEN = 8;
+const int TOUCH_TASK_CORE = 1;                // Same core as loop(), higher priority
+const int TOUCH_TASK_PRIORITY = 2;
+const int TOUCH_TASK_STACK = 3072;
+const TickType_t TOUCH_HELD_POLL_MS = 20;     // Re-read interval while a finger is down
+QueueHandle_t touchIrqQueue = nullptr;        // ISR -> touch task (interrupt timestamps)
+QueueHandle_t touchEventQueue = nullptr;      // Touch task -> loop (gestures)
+SemaphoreHandle_t touchBusMutex = nullptr;    // Guards the touch bus and its pins
+TaskHandle_t touchTaskHandle = nullptr;
+volatile uint32_t touchIrqs = 0;              // Interrupts since boot
+volatile uint32_t touchReads = 0;             // Controller reads since boot
+
+// Resistive touch calibration and touch traces. The touch task runs these
+// when it receives a request (negative) instead of an interrupt timestamp.
+const int CALIBRATION_POINTS = 3;
+const int CALIBRATION_TARGETS[CALIBRATION_POINTS][2] = { {32, 24}, {288, 120}, {160, 216} };
+const unsigned long CALIBRATION_TIMEOUT_MS = 30000;  // Per target, then the old matrix stays
+const int CALIBRATION_MIN_READS = 5;                 // Reads a target must be held for
+const int64_t TOUCH_CALIBRATE_REQUEST = -1;
+const int64_t TOUCH_RECORD_REQUEST = -2;   // Start/stop recording a touch trace
+const int64_t TOUCH_REPLAY_REQUEST = -3;   // Replay the recorded trace
+fs::File touchTraceFile;                   // Open while recording (touch task only)
+volatile bool touchRecording = false;
+bool calibrationShown = false;  // Targets are on the panel (render task only)
+#if defined(BOARD_CYD_RESISTIVE)
+TouchCalibration touchCal = TouchCalibration::fromRange(TOUCH_MIN_X, TOUCH_MAX_X, TOUCH_MIN_Y, TOUCH_MAX_Y, 320, 240);
+TouchFilter touchFilter;
+#endif
 
-// Button area for logs (lower right corner)
-const int LOG_BTN_X = 250;
-const int LOG_BTN_Y = 200;
-const int LOG_BTN_W = 70;
-const int LOG_BTN_H = 40;
+// Tap latency benchmark ('b'). The loop fills in a reset's sample up to
+// logEntry(); the render task adds the pixel time and records it.
+const int TAP_BENCH_DEFAULT_TAPS = 20;
+TapBench tapBench;
+TapSample benchSample;
+int64_t benchIrqMicros = 0;                // IRQ time benchSample is measured from
+volatile bool benchAwaitingPixels = false; // benchSample waits for drawTimerDisplay(0)
+
+// Clock text, formatted by the loop and handed to the render task in
+// RENDER_CLOCK commands
+const time_t CLOCK_MIN_SYNCED_EPOCH = 1600000000;  // Earlier means NTP has not synced
+char clockText[12] = "";                          // Last formatted text (loop only)
+time_t clockValidUntil = 0;                       // Reformat at or after this time
+
+// ===== ALARM SCHEDULER =====
+// A one-shot esp_timer armed for the session's next alarm (see
+// AlarmSchedule), re-armed from its own callback: nothing is checked in
+// between. sessionMutex keeps the callback and a new session from the loop
+// (a start, reset or undo) from crossing; the session start and fired count
+// only change under it. The tick timer shares it.
+AlarmSchedule alarmSchedule({ THRESHOLD_YELLOW, THRESHOLD_BLUE, ALARM_REPEAT_SECONDS, ALARM_MAX_BELLS,
+                              ALARM_FIRST_GAIN, ALARM_LAST_GAIN });
+esp_timer_handle_t alarmTimer = nullptr;
+SemaphoreHandle_t sessionMutex = nullptr;  // Created in setup()
+Alarm armedAlarm;  // What alarmTimer will play
+
+// ===== TICK SCHEDULER =====
+// A one-shot esp_timer is armed for the exact microsecond the elapsed time
+// rolls over to the next second, so every value is shown for ~1 s no matter
+// where in the second the timer was started. The loop only starts and
+// stops runs; every value, the first included, is posted by the callback,
+// and all of the state below is under sessionMutex.
+esp_timer_handle_t tickTimer = nullptr;
+bool ticksRunning = false;         // Between startTicks() and stopTicks()
+uint32_t tickRun = 0;              // Advanced by startTicks()
+unsigned long lastTickSeconds = 0; // Value most recently posted (esp_timer task)
+uint32_t tickCount = 0;            // Ticks since the last stats print
+uint32_t tickLateSum = 0;          // Sum of lateness past the boundary (us)
+uint32_t tickLateMax = 0;
+uint32_t tickSkips = 0;            // Ticks that jumped more than one second
+
+// Loop iteration timing (proves the loop stays flat while frames render)
+const unsigned long LOOP_STATS_INTERVAL_MS = 60000;
+
+// Heap fragmentation, printed with the loop stats: the largest block that
+// can still be allocated, against the total free
+size_t heapLargestMin = SIZE_MAX;  // Lowest largest-free-block seen since boot
 
 // ===== FUNCTION DECLARATIONS =====
 void initializeFileSystem();
 void connectWiFi();
 void initAudio();
-void playChime();
-void audioLoop();
-void reinitTouch();
+void playSound(SoundId sound);
+void playSoundAt(SoundId sound, float gain);
+void startAudioTask();
+void audioTask(void* param);
+void startSound(const AudioRequest& request);
+bool startVoice(int v);
+void stopVoice(int v);
+void startFileVoice();
+void loadAlertSound();
+void selectNextAlertSound();
+void startFlashStress();
+void runFlashStress();
+uint32_t readAheadMs(uint32_t bytes);
+uint8_t scheduleAlarms(int64_t startMicros, uint8_t fired);
+void armNextAlarm();
+void onAlarmTimer(void* arg);
+void pumpAudio();
+void printAudioHealth();
+void publishAudioHealth();
+AudioHealth readAudioHealth();
+MixerStats takeMixerStats();
+void fillAudioRing();
+void claimGpio25ForTouch();
 void logEntry(const char* message);
+bool appendLine(const char* path, const char* line);
 String getTimestamp();
-String getClockString();
-void drawClock(uint16_t bgColor);
-void drawTimerDisplay(int hours, int minutes, int seconds, uint16_t bgColor, bool forceFullRedraw = false);
+bool refreshClockText();
+void startTicks();
+void stopTicks();
+void onTickTimer(void* arg);
+void renderScreen(const Screen& screen);
+void drawTimerDisplay(unsigned long seconds);
 void drawWaitingScreen();
-void drawLogsButton(uint16_t bgColor);
 void drawLogsScreen();
 void clearLogs();
-bool readTouch(int &screenX, int &screenY);
-void handleTouchAt(int touchX, int touchY);
-unsigned long getElapsedSeconds();
+bool readTouch(TouchSample &sample);
 uint16_t getBackgroundColor(unsigned long seconds);
-void formatTime(unsigned long seconds, int &hours, int &minutes, int &secs);
-bool isTouchInLogsButton(int x, int y);
-bool isTouchInClearButton(int x, int y);
+void startRenderTask();
+void renderTask(void* param);
+bool postRender(RenderCmdType type, unsigned long seconds = 0, const char* text = nullptr);
+void logTimerStats();
+void recordLoopTime(unsigned long iterMicros, bool busy);
+void handleSerialCommands();
+void startTouchTask();
+void touchTask(void* param);
+bool readTouchLocked(TouchSample &sample);
+void toggleTouchRecording();
+void replayTouchTrace();
+void dumpTouchTrace();
+void loadTouchCalibration();
+void runTouchCalibration();
+void drawCalibrationTarget(int index);
+bool readTouchRaw(int &rawX, int &rawY, int &rawZ);
 
 // ===== SETUP =====
 void setup() {
@@ -157,6 +412,9 @@ void setup() {
   digitalWrite(TFT_BACKLIGHT, HIGH);
   Serial.println("Backlight ON");
 
+  // Timer session, shared by the alarm and tick timers
+  sessionMutex = xSemaphoreCreateMutex();
+
   // Initialize audio
   initAudio();
 
@@ -171,9 +429,19 @@ void setup() {
 
   tft.drawString("Initializing touch...", 160, 120);
 
+  // Screens (the running timer allocates its 240x50x16bpp = 24 KB sprite)
+  if (!beginScreens(tft)) {
+    Serial.println("WARNING: Timer sprite allocation failed, drawing direct");
+  }
+
+  // DMA for sprite pushes
+  bool dmaReady = initDisplayDMA(tft);
+  Serial.printf("Display DMA %s\n", dmaReady ? "enabled" : "unavailable, using blocking pushes");
+
   // ===== TOUCH CONTROLLER INITIALIZATION =====
 #if defined(BOARD_CYD_RESISTIVE)
   // XPT2046 Resistive Touch - uses SEPARATE SPI bus from display
+  // PENIRQ (TOUCH_IRQ) is pulled low while the panel is pressed
   Serial.printf("Touch pins: CS=%d, IRQ=%d, SCLK=%d, MOSI=%d, MISO=%d\n", 
                 TOUCH_CS, TOUCH_IRQ, TOUCH_SCLK, TOUCH_MOSI, TOUCH_MISO);
   
@@ -196,8 +464,8 @@ void setup() {
   delay(100);  // Wait for CST816S to boot
   Serial.println("Touch controller reset complete");
 
-  // Configure INT pin
-  pinMode(TOUCH_INT, INPUT);
+  // Configure INT pin (pulsed low by the controller on touch)
+  pinMode(TOUCH_INT, INPUT_PULLUP);
 
   // Initialize I2C for touch on correct pins (SDA=33, SCL=32)
   Wire.begin(TOUCH_SDA, TOUCH_SCL);
@@ -219,13 +487,23 @@ void setup() {
       byte fwVer = Wire.read();
       Serial.printf("  Chip ID: 0x%02X, Project: %d, FW: %d\n", chipId, projId, fwVer);
     }
+
+    // Interrupt on touch-down/up and periodically while held
+    Wire.beginTransmission(CST816S_ADDR);
+    Wire.write(CST816S_REG_IRQ_CTL);
+    Wire.write(CST816S_IRQ_EN_TOUCH | CST816S_IRQ_EN_CHANGE | CST816S_IRQ_EN_MOTION);
+    Wire.endTransmission();
   } else {
     Serial.println("WARNING: CST816S not found!");
   }
 #endif
 
+  startTouchTask();
   Serial.println("Touch controller ready");
 
+  // Audio after touch: starting the DAC takes GPIO25 back through the touch bus mutex
+  startAudioTask();
+
   tft.fillScreen(COLOR_BLACK);
   tft.drawString("Connecting to WiFi...", 160, 120);
 
@@ -238,30 +516,74 @@ void setup() {
   // Log boot entry
   logEntry("Boot");
 
-  // Initialize preferences (for future threshold storage)
+  // Initialize preferences (touch calibration, alert sound, future threshold storage)
   preferences.begin("nigel-timer", false);
   preferences.end();
+  loadTouchCalibration();
+  loadAlertSound();
+
+  // Hand the display over to the render task and draw the waiting screen
+  startRenderTask();
+  refreshClockText();
+  postRender(RENDER_CLOCK, 0, clockText);
+  postRender(RENDER_WAITING);
 
-  // Draw initial waiting screen
-  drawWaitingScreen();
+#if defined(BOARD_CYD_RESISTIVE)
+  // Holding the screen through boot starts the calibration wizard
+  if (ts.touched()) {
+    Serial.println("Screen held at boot - starting touch calibration");
+    xQueueSend(touchIrqQueue, &TOUCH_CALIBRATE_REQUEST, 0);
+  }
+#endif
 
   Serial.println("Ready! Waiting for first touch...");
 }
 
 // ===== TOUCH READ FUNCTION =====
-bool readTouch(int &screenX, int &screenY) {
 #if defined(BOARD_CYD_RESISTIVE)
-  // XPT2046 Resistive Touch
-  if (ts.touched()) {
+// Filtered raw position: median of a pressure-checked burst, smoothed over
+// the stroke. Called from the touch task only (blocks ~16 ms).
+bool readTouchRaw(int &rawX, int &rawY, int &rawZ) {
+  int16_t xs[TOUCH_BURST_SAMPLES], ys[TOUCH_BURST_SAMPLES], zs[TOUCH_BURST_SAMPLES];
+  int count = 0;
+  int light = 0;
+  while (count < TOUCH_BURST_SAMPLES) {
+    if (count > 0) {
+      vTaskDelay(pdMS_TO_TICKS(TOUCH_BURST_SPACING_MS));
+    }
     TS_Point p = ts.getPoint();
-    
-    // Map raw values to screen coordinates
-    screenX = map(p.x, TOUCH_MIN_X, TOUCH_MAX_X, 0, 320);
-    screenY = map(p.y, TOUCH_MIN_Y, TOUCH_MAX_Y, 0, 240);
+    xs[count] = p.x;
+    ys[count] = p.y;
+    zs[count] = p.z;
+    count++;
+    if (p.z < TOUCH_Z_MIN && ++light > TOUCH_BURST_SAMPLES - TOUCH_BURST_MIN_VALID) {
+      break;  // Can no longer reach enough valid samples
+    }
+  }
+  if (!touchFilter.filter(xs, ys, zs, count, TOUCH_Z_MIN, rawX, rawY, rawZ)) {
+    touchFilter.reset();  // Released (or a light brush): next touch starts fresh
+    return false;
+  }
+  return true;
+}
+#endif
+
+// Fills in position, pressure and hint; on a release only pressure (0)
+// and hint change, so the sample keeps the last position
+bool readTouch(TouchSample &sample) {
+  sample.pressure = 0;
+  sample.hint = GESTURE_NONE;
+#if defined(BOARD_CYD_RESISTIVE)
+  // XPT2046 Resistive Touch (points only, gestures are classified in software)
+  int rawX, rawY, rawZ;
+  if (readTouchRaw(rawX, rawY, rawZ)) {
+    int screenX, screenY;
+    touchCal.apply(rawX, rawY, screenX, screenY);
     
     // Clamp to screen bounds
-    screenX = constrain(screenX, 0, 319);
-    screenY = constrain(screenY, 0, 239);
+    sample.x = constrain(screenX, 0, 319);
+    sample.y = constrain(screenY, 0, 239);
+    sample.pressure = rawZ;
     
     return true;
   }
@@ -270,30 +592,37 @@ bool readTouch(int &screenX, int &screenY) {
 #elif defined(BOARD_CYD_CAPACITIVE)
   // CST816S Capacitive Touch - Direct I2C register reads
   Wire.beginTransmission(CST816S_ADDR);
-  Wire.write(0x02);  // Start at finger count register
+  Wire.write(CST816S_REG_GESTURE);  // Start at gesture ID register
   if (Wire.endTransmission(false) != 0) {
     return false;
   }
   
-  Wire.requestFrom(CST816S_ADDR, 5);
-  if (Wire.available() >= 5) {
+  Wire.requestFrom(CST816S_ADDR, 6);
+  if (Wire.available() >= 6) {
+    uint8_t gesture = Wire.read();  // 0x01 - gesture ID
     uint8_t fingers = Wire.read();  // 0x02 - finger count
     uint8_t xh = Wire.read();       // 0x03
     uint8_t xl = Wire.read();       // 0x04
     uint8_t yh = Wire.read();       // 0x05
     uint8_t yl = Wire.read();       // 0x06
+
+    // The controller's own gesture verdict; directions are left to the
+    // classifier, which works in rotated screen coordinates
+    switch (gesture) {
+      case 0x01: case 0x02: case 0x03: case 0x04: sample.hint = GESTURE_SWIPE_ANY; break;
+      case 0x05: sample.hint = GESTURE_TAP; break;
+      case 0x0B: sample.hint = GESTURE_DOUBLE_TAP; break;
+      case 0x0C: sample.hint = GESTURE_LONG_PRESS; break;
+    }
     
     if (fingers > 0) {
       uint16_t rawX = ((xh & 0x0F) << 8) | xl;
       uint16_t rawY = ((yh & 0x0F) << 8) | yl;
       
-      // Map for landscape rotation (rotation=1)
-      screenX = rawY;
-      screenY = 240 - rawX;
-      
-      // Clamp to screen bounds
-      screenX = constrain(screenX, 0, 319);
-      screenY = constrain(screenY, 0, 239);
+      // Map for landscape rotation (rotation=1), clamped to screen bounds
+      sample.x = constrain((int)rawY, 0, 319);
+      sample.y = constrain(240 - (int)rawX, 0, 239);
+      sample.pressure = fingers;
       
       return true;
     }
@@ -302,65 +631,270 @@ bool readTouch(int &screenX, int &screenY) {
 #endif
 }
 
-// ===== MAIN LOOP =====
-void loop() {
-  // Poll touch at ~20Hz
-  static unsigned long lastTouchRead = 0;
-  static bool wasTouched = false;
-  
-  if (millis() - lastTouchRead > 50) {
-    lastTouchRead = millis();
-    
-    int screenX, screenY;
-    
-    if (readTouch(screenX, screenY)) {
-      if (!wasTouched) {  // New touch started
-        wasTouched = true;
-        
-        Serial.printf("TOUCH: screen(%d,%d)\n", screenX, screenY);
-        
-        unsigned long currentMillis = millis();
-        if (currentMillis - lastTouchMillis >= TOUCH_DEBOUNCE_MS) {
-          // Process touch at (screenX, screenY)
-          handleTouchAt(screenX, screenY);
-          lastTouchMillis = currentMillis;
-        }
+// ===== TOUCH TASK FUNCTIONS =====
+
+void IRAM_ATTR onTouchIrq() {
+  int64_t now = esp_timer_get_time();
+  BaseType_t woken = pdFALSE;
+  xQueueSendFromISR(touchIrqQueue, &now, &woken);
+  touchIrqs++;
+  if (woken) {
+    portYIELD_FROM_ISR();
+  }
+}
+
+void startTouchTask() {
+  touchIrqQueue = xQueueCreate(TOUCH_IRQ_QUEUE_LEN, sizeof(int64_t));
+  touchEventQueue = xQueueCreate(TOUCH_EVENT_QUEUE_LEN, sizeof(TouchEvent));
+  touchBusMutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(touchTask, "touch", TOUCH_TASK_STACK, nullptr, TOUCH_TASK_PRIORITY,
+                          &touchTaskHandle, TOUCH_TASK_CORE);
+#if defined(BOARD_CYD_RESISTIVE)
+  pinMode(TOUCH_IRQ, INPUT);  // GPIO36 is input-only, pulled up on the board
+  attachInterrupt(digitalPinToInterrupt(TOUCH_IRQ), onTouchIrq, FALLING);
+#elif defined(BOARD_CYD_CAPACITIVE)
+  attachInterrupt(digitalPinToInterrupt(TOUCH_INT), onTouchIrq, FALLING);
+#endif
+  Serial.println("Touch task started (interrupt driven)");
+}
+
+bool readTouchLocked(TouchSample &sample) {
+  xSemaphoreTake(touchBusMutex, portMAX_DELAY);
+  bool touched = readTouch(sample);
+  xSemaphoreGive(touchBusMutex);
+  sample.ms = millis();
+  touchReads++;
+  return touched;
+}
+
+void postTouchEvent(const TouchEvent& event) {
+  xQueueSend(touchEventQueue, &event, 0);
+}
+
+// Into the pipeline, and into the trace file while recording
+void feedTouch(TouchPipeline& pipeline, const TouchSample& sample, int64_t micros) {
+  if (touchRecording) {
+    char line[48];
+    if (formatTouchSample(sample, line, sizeof(line)) > 0) {
+      touchTraceFile.println(line);
+    }
+  }
+  pipeline.feed(sample, micros);
+}
+
+void touchTask(void* param) {
+  TouchPipeline pipeline(postTouchEvent);
+  TouchSample sample = {};
+  int64_t irqMicros;
+  while (true) {
+    if (xQueueReceive(touchIrqQueue, &irqMicros, portMAX_DELAY) != pdTRUE) {
+      continue;
+    }
+    if (irqMicros < 0) {
+      // Requests from setup() and the serial commands
+      if (irqMicros == TOUCH_CALIBRATE_REQUEST) {
+        runTouchCalibration();
+      } else if (irqMicros == TOUCH_RECORD_REQUEST) {
+        toggleTouchRecording();
+      } else if (irqMicros == TOUCH_REPLAY_REQUEST) {
+        replayTouchTrace();
       }
-    } else {
-      wasTouched = false;
+      xQueueReset(touchIrqQueue);
+      continue;
     }
+
+    if (!readTouchLocked(sample)) {
+      continue;  // Release pulse or noise
+    }
+
+    // Follow the finger until it lifts, then drop the interrupts it raised
+    feedTouch(pipeline, sample, irqMicros);
+    do {
+      vTaskDelay(pdMS_TO_TICKS(TOUCH_HELD_POLL_MS));
+      readTouchLocked(sample);
+      feedTouch(pipeline, sample, esp_timer_get_time());
+    } while (sample.pressure > 0);
+    xQueueReset(touchIrqQueue);
   }
-  
-  // Update display if timer is running
-  if (currentState == RUNNING) {
-    unsigned long currentMillis = millis();
-    
-    // Update every second
-    if (currentMillis - lastUpdateMillis >= 1000) {
-      lastUpdateMillis = currentMillis;
-      
-      unsigned long elapsedSeconds = getElapsedSeconds();
-      int hours, minutes, seconds;
-      formatTime(elapsedSeconds, hours, minutes, seconds);
-      
-      // Only redraw if seconds changed
-      if (elapsedSeconds != lastDisplayedSeconds) {
-        uint16_t bgColor = getBackgroundColor(elapsedSeconds);
-        drawTimerDisplay(hours, minutes, seconds, bgColor);
-        lastDisplayedSeconds = elapsedSeconds;
-        
-        // Play chime when reaching green threshold (only once per timer session)
-        if (bgColor == COLOR_BLUE && !chimePlayedThisSession) {
-          Serial.println("Green threshold reached - playing chime!");
-          playChime();
-          chimePlayedThisSession = true;
+}
+
+// ===== TOUCH RECORD AND REPLAY =====
+
+void toggleTouchRecording() {
+  if (touchRecording) {
+    touchRecording = false;
+    touchTraceFile.close();
+    Serial.println("Touch recording stopped (send 'd' to dump it, 'y' to replay it)");
+    return;
+  }
+  touchTraceFile = LittleFS.open(TOUCH_TRACE_PATH, "w");
+  if (!touchTraceFile) {
+    Serial.println("ERROR: Failed to open touch trace file!");
+    return;
+  }
+  touchTraceFile.println(TOUCH_TRACE_HEADER);
+  touchRecording = true;
+  Serial.println("Touch recording started (send 't' again to stop)");
+}
+
+// Runs on the touch task: feeds the trace through a fresh pipeline at its
+// recorded pace, in place of the controller. The glass is not read meanwhile.
+void replayTouchTrace() {
+  if (touchRecording) {
+    Serial.println("ERROR: Stop touch recording before replaying");
+    return;
+  }
+  fs::File trace = LittleFS.open(TOUCH_TRACE_PATH, "r");
+  if (!trace) {
+    Serial.println("ERROR: No touch trace recorded");
+    return;
+  }
+
+  Serial.println("Replaying touch trace...");
+  TouchPipeline replay(postTouchEvent);
+  uint32_t startMillis = millis();
+  uint32_t firstMs = 0;
+  int samples = 0;
+  while (trace.available()) {
+    String line = trace.readStringUntil('\n');
+    TouchSample sample;
+    if (!parseTouchSample(line.c_str(), sample)) {
+      continue;
+    }
+    if (samples == 0) {
+      firstMs = sample.ms;
+    }
+    int32_t wait = (int32_t)(startMillis + (sample.ms - firstMs) - millis());
+    if (wait > 0) {
+      vTaskDelay(pdMS_TO_TICKS(wait));
+    }
+    replay.feed(sample, esp_timer_get_time());
+    samples++;
+  }
+  trace.close();
+  Serial.printf("Replayed %d touch samples\n", samples);
+}
+
+// Stream the trace over serial, to be saved and replayed on the host
+void dumpTouchTrace() {
+  if (touchRecording) {
+    Serial.println("ERROR: Stop touch recording before dumping");
+    return;
+  }
+  fs::File trace = LittleFS.open(TOUCH_TRACE_PATH, "r");
+  if (!trace) {
+    Serial.println("ERROR: No touch trace recorded");
+    return;
+  }
+  Serial.println("----- " TOUCH_TRACE_PATH " -----");
+  while (trace.available()) {
+    Serial.println(trace.readStringUntil('\n'));
+  }
+  Serial.println("----- end -----");
+  trace.close();
+}
+
+// ===== TOUCH CALIBRATION =====
+
+void loadTouchCalibration() {
+#if defined(BOARD_CYD_RESISTIVE)
+  TouchCalibration stored;
+  preferences.begin("nigel-timer", true);
+  size_t len = preferences.getBytes("touchCal", &stored, sizeof(stored));
+  preferences.end();
+  if (len == sizeof(stored)) {
+    touchCal = stored;
+    Serial.println("Touch calibration loaded");
+  } else {
+    Serial.println("No touch calibration stored, using defaults (hold screen at boot or send 'c')");
+  }
+#endif
+}
+
+// Runs on the touch task: shows each target, takes the filtered raw
+// position it settles at while held, then fits and stores the matrix
+void runTouchCalibration() {
+#if defined(BOARD_CYD_RESISTIVE)
+  int raw[CALIBRATION_POINTS][2];
+  bool ok = true;
+  for (int i = 0; i < CALIBRATION_POINTS && ok; i++) {
+    postRender(RENDER_CALIBRATE, i);
+    int reads = 0;
+    while (reads < CALIBRATION_MIN_READS) {
+      int64_t irqMicros;
+      if (xQueueReceive(touchIrqQueue, &irqMicros, pdMS_TO_TICKS(CALIBRATION_TIMEOUT_MS)) != pdTRUE) {
+        Serial.println("ERROR: Touch calibration timed out, keeping previous calibration");
+        ok = false;
+        break;
+      }
+      // Follow the press; a short one doesn't count
+      reads = 0;
+      int rawX, rawY, rawZ;
+      while (true) {
+        xSemaphoreTake(touchBusMutex, portMAX_DELAY);
+        bool touched = readTouchRaw(rawX, rawY, rawZ);
+        xSemaphoreGive(touchBusMutex);
+        if (!touched) {
+          break;
         }
+        raw[i][0] = rawX;
+        raw[i][1] = rawY;
+        reads++;
+        vTaskDelay(pdMS_TO_TICKS(TOUCH_HELD_POLL_MS));
       }
+      xQueueReset(touchIrqQueue);
     }
+    if (ok) {
+      Serial.printf("Calibration point %d: raw(%d,%d) -> screen(%d,%d)\n", i, raw[i][0], raw[i][1],
+                    CALIBRATION_TARGETS[i][0], CALIBRATION_TARGETS[i][1]);
+    }
+  }
+
+  TouchCalibration fitted;
+  if (ok && !TouchCalibration::solve(raw, CALIBRATION_TARGETS, fitted)) {
+    Serial.println("ERROR: Calibration points too close together, keeping previous calibration");
+    ok = false;
+  }
+  if (ok) {
+    touchCal = fitted;
+    preferences.begin("nigel-timer", false);
+    preferences.putBytes("touchCal", &fitted, sizeof(fitted));
+    preferences.end();
+    Serial.printf("Touch calibration saved: x = %.4f*rx + %.4f*ry + %.1f, y = %.4f*rx + %.4f*ry + %.1f\n",
+                  fitted.a, fitted.b, fitted.c, fitted.d, fitted.e, fitted.f);
+  }
+  postRender(RENDER_CALIBRATE, CALIBRATION_POINTS);
+#else
+  Serial.println("Touch calibration is only needed on the resistive board");
+#endif
+}
+
+// ===== MAIN LOOP =====
+void loop() {
+  unsigned long loopStartMicros = micros();
+  bool busyAtStart = renderBusy;
+
+  // Gestures from the touch task
+  TouchEvent touch;
+  while (xQueueReceive(touchEventQueue, &touch, 0) == pdTRUE) {
+    Serial.printf("TOUCH: %s at screen(%d,%d), %lld us after IRQ\n", gestureName(touch.gesture),
+                  touch.x, touch.y, esp_timer_get_time() - touch.irqMicros);
+    dispatchTouch(touch);
+  }
+  
+  // Timer redraws and alarms run off their own timers; wake the renderer
+  // for the clock only when its minute rolls over
+  if (refreshClockText() && !postRender(RENDER_CLOCK, 0, clockText)) {
+    clockValidUntil = 0;  // Queue full: try again next iteration
+    clockText[0] = '\0';
   }
   
-  // Handle audio playback
-  audioLoop();
+  handleSerialCommands();
+  if (flashStressUntil != 0) {
+    runFlashStress();
+  }
+
+  recordLoopTime(micros() - loopStartMicros, busyAtStart || renderBusy);
 
   delay(1);  // Small delay to prevent tight loop
 }
@@ -438,142 +972,144 @@ String getTimestamp() {
   return String(timestamp);
 }
 
-String getClockString() {
-  if (!wifiConnected) {
-    return "No WiFi";
+// Format the clock only when the cached text can have gone stale: once a
+// minute, or every second until NTP has synced. Between boundaries this is
+// a time() call and a compare. Returns true if the text changed.
+bool refreshClockText() {
+  time_t now = time(nullptr);
+  if (now < clockValidUntil) {
+    return false;
   }
 
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    return "No Time";
+  char text[sizeof(clockText)];
+  if (!wifiConnected) {
+    strcpy(text, "No WiFi");
+    clockValidUntil = now + 60;
+  } else if (now < CLOCK_MIN_SYNCED_EPOCH) {
+    strcpy(text, "No Time");
+    clockValidUntil = now + 1;
+  } else {
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    strftime(text, sizeof(text), "%I:%M%p", &timeinfo);
+    clockValidUntil = now - timeinfo.tm_sec + 60;
   }
 
-  char clockStr[16];
-  strftime(clockStr, sizeof(clockStr), "%I:%M%p", &timeinfo);
-  return String(clockStr);
-}
-
-void drawClock(uint16_t bgColor) {
-  // Draw clock in lower left corner
-  uint16_t textColor = (bgColor == COLOR_YELLOW) ? COLOR_BLACK : COLOR_WHITE;
-
-  // Clear clock area
-  tft.fillRect(0, 210, 100, 30, bgColor);
-
-  String clockStr = getClockString();
-  tft.setTextColor(textColor);
-  tft.setTextDatum(BL_DATUM);
-  tft.setTextSize(2);
-  tft.drawString(clockStr.c_str(), 5, 235);
+  if (strcmp(text, clockText) == 0) {
+    return false;
+  }
+  strcpy(clockText, text);
+  return true;
 }
 
 void logEntry(const char* message) {
-  fs::File logFile = LittleFS.open("/logs.txt", "a");
-  if (!logFile) {
-    Serial.println("ERROR: Failed to open log file!");
-    return;
-  }
-
   String timestamp = getTimestamp();
   char logLine[128];
   snprintf(logLine, sizeof(logLine), "%s %s", timestamp.c_str(), message);
 
-  logFile.println(logLine);
-  logFile.close();
+  if (!appendLine("/logs.txt", logLine)) {
+    Serial.println("ERROR: Failed to open log file!");
+    return;
+  }
 
   Serial.print("LOG: ");
   Serial.println(logLine);
 }
 
-void drawWaitingScreen() {
-  tft.fillScreen(COLOR_RED);
-  lastBgColor = COLOR_RED;
-
-  // Draw title at top
-  tft.setTextColor(COLOR_WHITE);
-  tft.setTextDatum(TC_DATUM);  // Top center
-  tft.setTextSize(3);
-  tft.drawString("Nigel Timer!", 160, 20);
-
-  // Draw "Touch to Start" message
-  tft.setTextDatum(MC_DATUM);  // Middle center
-  tft.setTextSize(2);
-  tft.drawString("Touch to Start", 160, 100);
-
-  // Draw timer at 0:00:00 with whitespace above
-  tft.setTextSize(4);
-  tft.drawString("00:00:00", 160, 170);
-
-  // Draw clock in lower left
-  drawClock(COLOR_RED);
-
-  // Draw logs button
-  drawLogsButton(COLOR_RED);
-}
-
-void drawLogsButton(uint16_t bgColor) {
-  // Draw a small "Logs" button in lower right corner
-  uint16_t btnColor = (bgColor == COLOR_YELLOW) ? COLOR_BLACK : COLOR_WHITE;
-  tft.drawRect(LOG_BTN_X, LOG_BTN_Y, LOG_BTN_W, LOG_BTN_H, btnColor);
-  tft.setTextColor(btnColor);
-  tft.setTextDatum(MC_DATUM);
-  tft.setTextSize(1);
-  tft.drawString("LOGS", LOG_BTN_X + LOG_BTN_W/2, LOG_BTN_Y + LOG_BTN_H/2);
+// Open, append one line and close: the flash work of every log entry
+bool appendLine(const char* path, const char* line) {
+  fs::File file = LittleFS.open(path, "a");
+  if (!file) {
+    return false;
+  }
+  file.println(line);
+  file.close();
+  return true;
 }
 
-bool isTouchInLogsButton(int x, int y) {
-  return (x >= LOG_BTN_X && x <= LOG_BTN_X + LOG_BTN_W &&
-          y >= LOG_BTN_Y && y <= LOG_BTN_Y + LOG_BTN_H);
+void clearLogs() {
+  LittleFS.remove("/logs.txt");
+  Serial.println("Logs cleared!");
 }
 
-// Clear button area (lower left corner)
-const int CLEAR_BTN_X = 10;
-const int CLEAR_BTN_Y = 200;
-const int CLEAR_BTN_W = 70;
-const int CLEAR_BTN_H = 30;
-
-// Test chime button area (lower right corner on logs screen)
-const int TEST_BTN_X = 240;
-const int TEST_BTN_Y = 200;
-const int TEST_BTN_W = 70;
-const int TEST_BTN_H = 30;
+// ===== SCREENS =====
 
-bool isTouchInClearButton(int x, int y) {
-  return (x >= CLEAR_BTN_X && x <= CLEAR_BTN_X + CLEAR_BTN_W &&
-          y >= CLEAR_BTN_Y && y <= CLEAR_BTN_Y + CLEAR_BTN_H);
+// Composite a screen; frames that repaint more than timer digits are logged
+void renderScreen(const Screen& screen) {
+  if (calibrationShown) {
+    shownScreen = &screen;  // Widgets are updated; drawn when calibration ends
+    return;
+  }
+  compositor.render(tft, screen);
+  shownScreen = &screen;
+  if (compositor.lastDirtyRects() > 0) {
+    Serial.printf("Frame: %d dirty rects, %u px (fillScreen = %d px)\n",
+                  compositor.lastDirtyRects(), compositor.lastPixels(), SCREEN_RECT.w * SCREEN_RECT.h);
+  }
 }
 
-bool isTouchInTestButton(int x, int y) {
-  return (x >= TEST_BTN_X && x <= TEST_BTN_X + TEST_BTN_W &&
-          y >= TEST_BTN_Y && y <= TEST_BTN_Y + TEST_BTN_H);
+void drawWaitingScreen() {
+  PROFILE_SCOPE(PROF_WAITING_SCREEN);
+  applyTheme(COLOR_RED);
+  renderScreen(waitingScreen);
 }
 
-void clearLogs() {
-  LittleFS.remove("/logs.txt");
-  Serial.println("Logs cleared!");
+void drawTimerDisplay(unsigned long seconds) {
+  PROFILE_SCOPE(PROF_TIMER_DISPLAY);
+  applyTheme(getBackgroundColor(seconds));
+  runningTimer.setSeconds(seconds);
+  renderScreen(runningScreen);
+
+  // A tick queued before the reset is not the reset's frame
+  if (benchAwaitingPixels && seconds == 0) {
+    benchSample.pixelsMicros = esp_timer_get_time() - benchIrqMicros;
+    benchAwaitingPixels = false;
+    if (tapBench.record(benchSample)) {
+      tapBench.report([](const char* line) { Serial.println(line); });
+    } else {
+      Serial.printf("Tap benchmark: %d more resets\n", tapBench.remaining());
+    }
+  }
+  logTimerStats();
 }
 
-void drawLogsScreen() {
-  tft.fillScreen(COLOR_BLACK);
+// Calibration target 'index' on a blank panel; CALIBRATION_POINTS puts the
+// current screen back
+void drawCalibrationTarget(int index) {
+  if (index >= CALIBRATION_POINTS) {
+    calibrationShown = false;
+    compositor.invalidateAll();
+    if (shownScreen != nullptr) {
+      renderScreen(*shownScreen);
+    }
+    return;
+  }
 
-  // Title
-  tft.setTextColor(COLOR_WHITE);
-  tft.setTextDatum(TC_DATUM);
-  tft.setTextSize(2);
-  tft.drawString("Recent Logs", 160, 10);
+  calibrationShown = true;
+  int x = CALIBRATION_TARGETS[index][0];
+  int y = CALIBRATION_TARGETS[index][1];
+  tft.fillScreen(COLOR_BLACK);
+  tft.setTextColor(COLOR_WHITE, COLOR_BLACK);
+  tft.setTextDatum(MC_DATUM);
+  tft.setTextSize(1);
+  tft.drawString("Touch calibration: press and hold the cross", 160, 100);
+  tft.drawString(String(index + 1) + " of " + String(CALIBRATION_POINTS), 160, 140);
+  tft.drawFastHLine(x - 10, y, 21, COLOR_WHITE);
+  tft.drawFastVLine(x, y - 10, 21, COLOR_WHITE);
+  tft.drawCircle(x, y, 6, COLOR_WHITE);
+}
 
+void drawLogsScreen() {
+  PROFILE_SCOPE(PROF_LOGS_SCREEN);
   // Read and display logs (most recent first)
   fs::File logFile = LittleFS.open("/logs.txt", "r");
   if (!logFile) {
-    tft.setTextDatum(MC_DATUM);
-    tft.drawString("No logs found", 160, 120);
-    // Still draw clear button and footer
+    setLogLines(nullptr, 0);
   }
 
   else {
-    // Read ALL lines, keeping only the last MAX_DISPLAY in a circular buffer
-    const int MAX_DISPLAY = 9;
-    String lines[MAX_DISPLAY];
+    // Read ALL lines, keeping only the last LOG_LINES in a circular buffer
+    String lines[LOG_LINES];
     int writeIdx = 0;
     int totalLines = 0;
 
@@ -581,181 +1117,368 @@ void drawLogsScreen() {
       String line = logFile.readStringUntil('\n');
       line.trim();  // Remove \r and whitespace
       lines[writeIdx] = line;
-      writeIdx = (writeIdx + 1) % MAX_DISPLAY;
+      writeIdx = (writeIdx + 1) % LOG_LINES;
       totalLines++;
     }
     logFile.close();
 
-    // Display lines (most recent first)
-    tft.setTextDatum(TL_DATUM);
-    tft.setTextSize(1);
-    int yPos = 40;
-    int numToShow = min(totalLines, MAX_DISPLAY);
-
     // Start from most recent (one before writeIdx) and go backwards
+    const char* recent[LOG_LINES];
+    int numToShow = min(totalLines, LOG_LINES);
     for (int i = 0; i < numToShow; i++) {
-      int idx = (writeIdx - 1 - i + MAX_DISPLAY) % MAX_DISPLAY;
-      tft.drawString(lines[idx].c_str(), 10, yPos);
-      yPos += 18;
+      recent[i] = lines[(writeIdx - 1 - i + LOG_LINES) % LOG_LINES].c_str();
     }
+    setLogLines(recent, numToShow);
   }
 
-  // Clear button (lower left)
-  tft.drawRect(CLEAR_BTN_X, CLEAR_BTN_Y, CLEAR_BTN_W, CLEAR_BTN_H, COLOR_RED);
-  tft.setTextColor(COLOR_RED);
-  tft.setTextDatum(MC_DATUM);
-  tft.setTextSize(1);
-  tft.drawString("CLEAR", CLEAR_BTN_X + CLEAR_BTN_W/2, CLEAR_BTN_Y + CLEAR_BTN_H/2);
-
-  // Test chime button (lower right)
-  tft.drawRect(TEST_BTN_X, TEST_BTN_Y, TEST_BTN_W, TEST_BTN_H, COLOR_GREEN);
-  tft.setTextColor(COLOR_GREEN);
-  tft.setTextDatum(MC_DATUM);
-  tft.setTextSize(1);
-  tft.drawString("TEST", TEST_BTN_X + TEST_BTN_W/2, TEST_BTN_Y + TEST_BTN_H/2);
-
-  // Footer instruction
-  tft.setTextDatum(BC_DATUM);
-  tft.setTextSize(1);
-  tft.setTextColor(COLOR_YELLOW);
-  tft.drawString("Touch anywhere to return", 160, 235);
+  char health[64];
+  AudioHealth snapshot = readAudioHealth();
+  formatAudioHealth(snapshot, AUDIO_DMA_BUFFER_FRAMES, health, sizeof(health));
+  setAudioHealth(health, snapshot.underruns() == 0);
+  renderScreen(logsScreen);
 }
 
-void drawTimerDisplay(int hours, int minutes, int seconds, uint16_t bgColor, bool forceFullRedraw) {
-  // Choose text color based on background (black on yellow for readability)
-  uint16_t textColor = (bgColor == COLOR_YELLOW) ? COLOR_BLACK : COLOR_WHITE;
-
-  // Only redraw full screen if background color changed or forced
-  if (forceFullRedraw || bgColor != lastBgColor) {
-    tft.fillScreen(bgColor);
-    lastBgColor = bgColor;
+// Timer readout SPI and glyph stats, every SPI_STATS_LOG_TICKS ticks
+void logTimerStats() {
+  if (++timerTicksSinceLog < SPI_STATS_LOG_TICKS) {
+    return;
+  }
+  TimerReadout::Stats stats = runningTimer.takeStats();
+  uint32_t legacyPixels = TIMER_W * TIMER_H + LEGACY_TIMER_TEXT_PIXELS;
+  Serial.printf("SPI per tick: %u px (%u bytes), legacy path ~%u px (%u bytes)\n",
+                stats.lastPixels, stats.lastPixels * 2, legacyPixels, legacyPixels * 2);
+  Serial.printf("Glyphs redrawn: %u in %u ticks (%.2f/s), decode %.1f us/glyph\n",
+                stats.glyphs, timerTicksSinceLog, (float)stats.glyphs / timerTicksSinceLog,
+                stats.glyphs ? (float)stats.decodeMicros / stats.glyphs : 0.0f);
+  timerTicksSinceLog = 0;
+}
 
-    // Draw title at top
-    tft.setTextColor(textColor);
-    tft.setTextDatum(TC_DATUM);  // Top center
-    tft.setTextSize(3);
-    tft.drawString("Nigel Timer!", 160, 20);
+// ===== RENDER TASK FUNCTIONS =====
 
-    // Draw logs button
-    drawLogsButton(bgColor);
+void startRenderTask() {
+  renderQueue = xQueueCreate(RENDER_QUEUE_LEN, sizeof(RenderCmd));
+  xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, nullptr, 1,
+                          &renderTaskHandle, RENDER_TASK_CORE);
+  Serial.printf("Render task started on core %d\n", RENDER_TASK_CORE);
+}
 
-    // Draw clock
-    drawClock(bgColor);
-    lastClockStr = getClockString();
-  } else {
-    // Just clear the timer area (approximate size of text)
-    tft.fillRect(40, 130, 240, 50, bgColor);
+// Queue a draw request and return immediately. Timer ticks are superseded
+// by the next one, so a full queue just drops the request; returns false so
+// callers that can't wait for a next one (the clock) can retry.
+bool postRender(RenderCmdType type, unsigned long seconds, const char* text) {
+  RenderCmd cmd = { type, seconds, "" };
+  if (text != nullptr) {
+    strncpy(cmd.text, text, sizeof(cmd.text) - 1);
+  }
+  if (xQueueSend(renderQueue, &cmd, 0) != pdTRUE) {
+    renderDropped++;
+    return false;
+  }
+  return true;
+}
 
-    // Update clock if minute changed
-    String currentClock = getClockString();
-    if (currentClock != lastClockStr) {
-      drawClock(bgColor);
-      lastClockStr = currentClock;
+void renderTask(void* param) {
+  RenderCmd cmd;
+  while (true) {
+    if (xQueueReceive(renderQueue, &cmd, portMAX_DELAY) != pdTRUE) {
+      continue;
     }
+    renderBusy = true;
+
+    switch (cmd.type) {
+      case RENDER_WAITING:
+        drawWaitingScreen();
+        break;
+      case RENDER_TIMER:
+        drawTimerDisplay(cmd.seconds);
+        break;
+      case RENDER_CLOCK:
+        // Re-rendering a screen without the clock pushes nothing
+        clockWidget.setText(cmd.text);
+        if (shownScreen != nullptr) {
+          renderScreen(*shownScreen);
+        }
+        break;
+      case RENDER_LOGS:
+        drawLogsScreen();
+        break;
+      case RENDER_CALIBRATE:
+        drawCalibrationTarget(cmd.seconds);
+        break;
+      case RENDER_PROFILE:
+        // Printed from this task so no sample is recorded mid-dump
+        profileDump([](const char* line) { Serial.println(line); });
+        if (cmd.seconds != 0) {
+          profileReset();
+          Serial.println("Profile reset");
+        }
+        break;
+    }
+    renderFrames++;
+    renderBusy = false;
   }
+}
 
-  // Format time string
-  char timeStr[16];
-  snprintf(timeStr, sizeof(timeStr), "%02d:%02d:%02d", hours, minutes, seconds);
+// ===== TICK SCHEDULER FUNCTIONS =====
+
+// Show the current value and keep it updated: arms the timer to fire at
+// once. Called when the session starts or resets, and when returning from
+// the logs.
+void startTicks() {
+  if (tickTimer == nullptr) {
+    esp_timer_create_args_t args = {};
+    args.callback = onTickTimer;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "tick";
+    if (esp_timer_create(&args, &tickTimer) != ESP_OK) {
+      Serial.println("ERROR: Could not create tick timer");
+      tickTimer = nullptr;
+      return;
+    }
+  }
 
-  // Draw time below title with whitespace
-  tft.setTextColor(textColor);
-  tft.setTextDatum(MC_DATUM);  // Middle center
-  tft.setTextSize(4);
-  tft.drawString(timeStr, 160, 150);
+  // Under the lock the callback is either done re-arming or not started;
+  // one already dispatched sees the new run and counts as its first tick
+  xSemaphoreTake(sessionMutex, portMAX_DELAY);
+  ticksRunning = true;
+  tickRun++;
+  esp_timer_stop(tickTimer);
+  esp_err_t err = esp_timer_start_once(tickTimer, 0);
+  xSemaphoreGive(sessionMutex);
+  if (err != ESP_OK) {
+    Serial.printf("ERROR: Could not start tick timer (%d)\n", err);
+  }
 }
 
-void handleTouch() {
-  // Legacy function - no longer used with direct register reads
-  Serial.println("handleTouch() called - should use handleTouchAt() instead");
+void stopTicks() {
+  if (tickTimer == nullptr) {
+    return;
+  }
+  xSemaphoreTake(sessionMutex, portMAX_DELAY);
+  ticksRunning = false;  // In case the callback is already dispatched
+  esp_timer_stop(tickTimer);
+  xSemaphoreGive(sessionMutex);
 }
 
-void handleTouchAt(int touchX, int touchY) {
-  Serial.printf("Processing touch at: %d, %d\n", touchX, touchY);
+// Runs on the esp_timer task at (or just after) a second boundary, or at
+// once for the first tick of a run
+void onTickTimer(void* arg) {
+  static uint32_t seenRun = 0;
+  xSemaphoreTake(sessionMutex, portMAX_DELAY);
+  if (!ticksRunning) {
+    xSemaphoreGive(sessionMutex);
+    return;
+  }
+  int64_t elapsed = esp_timer_get_time() - timerStartMicros;
+  unsigned long seconds = elapsed / 1000000;
 
-  if (currentState == VIEWING_LOGS) {
-    // Check if clear button was pressed
-    if (isTouchInClearButton(touchX, touchY)) {
-      Serial.println("Clear logs button pressed");
-      clearLogs();
-      drawLogsScreen();  // Redraw to show empty logs
-      return;
+  if (tickRun != seenRun) {
+    seenRun = tickRun;  // Not on a boundary: nothing to measure
+  } else {
+    uint32_t late = elapsed - (int64_t)seconds * 1000000;
+    tickCount++;
+    tickLateSum += late;
+    tickLateMax = max(tickLateMax, late);
+    if (seconds != lastTickSeconds + 1) {
+      tickSkips++;
     }
+  }
+  lastTickSeconds = seconds;
+
+  postRender(RENDER_TIMER, seconds);
+  esp_timer_stop(tickTimer);  // Armed by startTicks() while this waited for the lock
+  esp_err_t err = esp_timer_start_once(tickTimer, (seconds + 1) * 1000000LL - elapsed);
+  xSemaphoreGive(sessionMutex);
+  if (err != ESP_OK) {
+    Serial.printf("ERROR: Could not re-arm tick timer (%d)\n", err);
+  }
+}
 
-    // Check if test chime button was pressed
-    if (isTouchInTestButton(touchX, touchY)) {
-      Serial.println("Test chime button pressed");
-      playChime();
-      return;  // Stay on logs screen
+// ===== ALARM SCHEDULER FUNCTIONS =====
+
+// The session started, was reset or was undone: set it, drop the armed
+// alarm and arm the one due next. Returns the replaced session's fired count.
+uint8_t scheduleAlarms(int64_t startMicros, uint8_t fired) {
+  if (alarmTimer == nullptr) {
+    esp_timer_create_args_t args = {};
+    args.callback = onAlarmTimer;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "alarm";
+    if (esp_timer_create(&args, &alarmTimer) != ESP_OK) {
+      Serial.println("ERROR: Could not create alarm timer");
+      alarmTimer = nullptr;
     }
+  }
 
-    // Any other touch returns to previous state
-    Serial.println("Returning from logs");
-    currentState = stateBeforeLogs;
-    lastBgColor = 0;  // Force full redraw
+  xSemaphoreTake(sessionMutex, portMAX_DELAY);
+  uint8_t replaced = alarmsFiredThisSession;
+  timerStartMicros = startMicros;
+  alarmsFiredThisSession = fired;
+  if (alarmTimer != nullptr) {
+    armNextAlarm();
+  }
+  xSemaphoreGive(sessionMutex);
+  return replaced;
+}
 
-    if (currentState == WAITING_TO_START) {
-      drawWaitingScreen();
-    } else {
-      unsigned long elapsedSeconds = getElapsedSeconds();
-      int hours, minutes, seconds;
-      formatTime(elapsedSeconds, hours, minutes, seconds);
-      drawTimerDisplay(hours, minutes, seconds, getBackgroundColor(elapsedSeconds), true);
-    }
-    return;
+// With sessionMutex held
+void armNextAlarm() {
+  esp_timer_stop(alarmTimer);
+  int64_t elapsed = esp_timer_get_time() - timerStartMicros;
+  if (!alarmSchedule.next(alarmsFiredThisSession, elapsed / 1000000, armedAlarm)) {
+    return;  // All played: quiet until the next reset
   }
+  int64_t wait = armedAlarm.atSeconds * 1000000LL - elapsed;
+  esp_timer_start_once(alarmTimer, wait > 0 ? wait : 0);
+}
 
-  // Check if logs button was pressed (works from waiting or running state)
-  if ((currentState == RUNNING || currentState == WAITING_TO_START) && isTouchInLogsButton(touchX, touchY)) {
-    Serial.println("Logs button pressed");
-    stateBeforeLogs = currentState;  // Remember where we came from
-    currentState = VIEWING_LOGS;
-    drawLogsScreen();
+// Runs on the esp_timer task when an alarm is due
+void onAlarmTimer(void* arg) {
+  xSemaphoreTake(sessionMutex, portMAX_DELAY);
+  if (esp_timer_get_time() - timerStartMicros < armedAlarm.atSeconds * 1000000LL) {
+    // Fired just as a reset re-armed it for the new session: not due yet
+    xSemaphoreGive(sessionMutex);
     return;
   }
+  Serial.printf("Alarm %u of %d: %s\n", armedAlarm.index + 1, alarmSchedule.count(), soundName(armedAlarm.sound));
+  playSoundAt(armedAlarm.sound, armedAlarm.gain);
+  alarmsFiredThisSession = armedAlarm.index + 1;
+  armNextAlarm();
+  xSemaphoreGive(sessionMutex);
+}
+
+// Track loop() iteration time separately for idle and render-in-flight
+// iterations, printed once a minute
+void recordLoopTime(unsigned long iterMicros, bool busy) {
+  static unsigned long lastReportMillis = 0;
+  static unsigned long maxIdle = 0, maxBusy = 0;
+  static unsigned long sumIdle = 0, sumBusy = 0;
+  static uint32_t countIdle = 0, countBusy = 0;
+
+  if (busy) {
+    maxBusy = max(maxBusy, iterMicros);
+    sumBusy += iterMicros;
+    countBusy++;
+  } else {
+    maxIdle = max(maxIdle, iterMicros);
+    sumIdle += iterMicros;
+    countIdle++;
+  }
 
-  if (currentState == WAITING_TO_START) {
-    // First touch (not on logs button) - start the timer
-    Serial.println("Timer started!");
-    currentState = RUNNING;
-    timerStartMillis = millis();
-    lastUpdateMillis = millis();
-    lastDisplayedSeconds = 0;
-    chimePlayedThisSession = false;  // Reset chime flag for new timer session
+  if (millis() - lastReportMillis >= LOOP_STATS_INTERVAL_MS) {
+    lastReportMillis = millis();
+    Serial.printf("Loop: idle avg %lu / max %lu us (%u), rendering avg %lu / max %lu us (%u), frames %u, dropped %u\n",
+                  countIdle ? sumIdle / countIdle : 0, maxIdle, countIdle,
+                  countBusy ? sumBusy / countBusy : 0, maxBusy, countBusy,
+                  renderFrames, renderDropped);
+    Serial.printf("Touch: %u interrupts, %u controller reads, GPIO25 reclaimed from the DAC %u times since boot\n",
+                  touchIrqs, touchReads, gpio25Reclaims);
+    printAudioHealth();
+    MixerStats mix = takeMixerStats();
+    if (mix.samples > 0) {
+      Serial.printf("Mixer: %u samples, %.0f ns/sample, up to %u voices\n", mix.samples,
+                    mix.micros * 1000.0f / mix.samples, mix.voicesPeak);
+    }
+    AudioFileSourceReadAhead::Stats fileStats = soundFile.takeStats();
+    if (fileStats.chunks > 0) {
+      Serial.printf("Sound file: %u chunks, worst read %u us, open %u us, read-ahead low %u ms, starved %u\n",
+                    fileStats.chunks, fileStats.worstReadMicros, fileStats.worstOpenMicros,
+                    readAheadMs(fileStats.lowWater), fileStats.starved);
+    }
+    size_t heapFree = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    size_t heapLargest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    heapLargestMin = min(heapLargestMin, heapLargest);
+    Serial.printf("Heap: %u free, largest block %u (lowest %u since boot), %u%% fragmented\n",
+                  heapFree, heapLargest, heapLargestMin,
+                  heapFree ? 100 - (unsigned)(heapLargest * 100 / heapFree) : 0);
+    xSemaphoreTake(sessionMutex, portMAX_DELAY);
+    uint32_t ticks = tickCount, lateSum = tickLateSum, lateMax = tickLateMax, skips = tickSkips;
+    tickCount = tickLateSum = tickLateMax = tickSkips = 0;
+    xSemaphoreGive(sessionMutex);
+    if (ticks > 0) {
+      Serial.printf("Ticks: %u, late avg %u / max %u us, skipped %u\n",
+                    ticks, lateSum / ticks, lateMax, skips);
+    }
+    maxIdle = maxBusy = sumIdle = sumBusy = 0;
+    countIdle = countBusy = 0;
+  }
+}
 
-    // Draw initial running display (force full redraw)
-    drawTimerDisplay(0, 0, 0, COLOR_RED, true);
+// Single-character commands on the serial console:
+//   p  print the draw profile
+//   r  print it, then reset it
+void handleSerialCommands() {
+  while (Serial.available() > 0) {
+    switch (Serial.read()) {
+      case 'p':
+        postRender(RENDER_PROFILE, 0);
+        break;
+      case 'r':
+        postRender(RENDER_PROFILE, 1);
+        break;
+      case 'c':
+        xQueueSend(touchIrqQueue, &TOUCH_CALIBRATE_REQUEST, 0);
+        break;
+      case 't':
+        xQueueSend(touchIrqQueue, &TOUCH_RECORD_REQUEST, 0);
+        break;
+      case 'y':
+        xQueueSend(touchIrqQueue, &TOUCH_REPLAY_REQUEST, 0);
+        break;
+      case 'd':
+        dumpTouchTrace();
+        break;
+      case 'b':
+        tapBench.start(TAP_BENCH_DEFAULT_TAPS);
+        Serial.printf("Tap benchmark: tap the running timer %d times\n", TAP_BENCH_DEFAULT_TAPS);
+        break;
+      case 's': {
+        static uint8_t nextSound = 0;  // Each press plays the next sound in turn
+        playSound((SoundId)nextSound);
+        nextSound = (nextSound + 1) % SOUND_COUNT;
+        break;
+      }
+      case 'a':
+        printAudioHealth();
+        break;
+      case 'f':
+        selectNextAlertSound();
+        break;
+      case 'w':
+        startFlashStress();
+        break;
+    }
+  }
+}
 
-  } else if (currentState == RUNNING) {
-    // Subsequent touch (not on logs button) - log duration and reset
-    unsigned long elapsedSeconds = getElapsedSeconds();
-    int hours, minutes, seconds;
-    formatTime(elapsedSeconds, hours, minutes, seconds);
+void handleTouch() {
+  // Legacy function - no longer used with direct register reads
+  Serial.println("handleTouch() called - should use handleTouchAt() instead");
+}
 
-    // Log the duration
-    char logMessage[64];
-    snprintf(logMessage, sizeof(logMessage), "-- Duration: %02d:%02d:%02d", hours, minutes, seconds);
-    logEntry(logMessage);
+// ===== TIMER STATE MACHINE PLATFORM =====
+// What timer_app.cpp needs from the board
 
-    Serial.print("Timer reset! Previous duration: ");
-    Serial.println(logMessage);
+int64_t platformMicros() {
+  return esp_timer_get_time();
+}
 
-    // Reset timer
-    timerStartMillis = millis();
-    lastUpdateMillis = millis();
-    lastDisplayedSeconds = 0;
-    chimePlayedThisSession = false;  // Reset chime flag for new timer session
+void showWaitingScreen() {
+  postRender(RENDER_WAITING);
+}
 
-    // Redraw with red background (force full redraw)
-    drawTimerDisplay(0, 0, 0, COLOR_RED, true);
-  }
+void showLogsScreen() {
+  postRender(RENDER_LOGS);
 }
 
-unsigned long getElapsedSeconds() {
-  if (currentState != RUNNING) {
-    return 0;
+void onResetLogged(int64_t irqMicros, int64_t handlerMicros) {
+  if (tapBench.active() && !benchAwaitingPixels) {
+    // Taps act on release, so irq->handler includes the time the finger was down
+    benchIrqMicros = irqMicros;
+    benchSample.handlerMicros = handlerMicros - irqMicros;
+    benchSample.loggedMicros = esp_timer_get_time() - irqMicros;
+    benchAwaitingPixels = true;
   }
-  return (millis() - timerStartMillis) / 1000;
 }
 
 uint16_t getBackgroundColor(unsigned long seconds) {
@@ -768,11 +1491,6 @@ uint16_t getBackgroundColor(unsigned long seconds) {
   }
 }
 
-void formatTime(unsigned long totalSeconds, int &hours, int &minutes, int &secs) {
-  hours = totalSeconds / 3600;
-  minutes = (totalSeconds % 3600) / 60;
-  secs = totalSeconds % 60;
-}
 
 // ===== AUDIO FUNCTIONS =====
 
@@ -804,81 +1522,451 @@ void initAudio() {
   // Internal DAC uses GPIO25 (left) and GPIO26 (right)
   // CYD boards have speaker connected to GPIO26
   // Use mono mode to avoid GPIO25 conflict with touch SPI clock on resistive board
-  audioOut = new AudioOutputI2S(0, AudioOutputI2S::INTERNAL_DAC);
+  audioOut = new AudioOutputI2S(0, AudioOutputI2S::INTERNAL_DAC, AUDIO_DMA_BUFFERS);
   audioOut->SetOutputModeMono(true);  // Mono on GPIO26 only, avoids GPIO25 conflict
   audioOut->SetGain(0.5);  // 50% volume (0.0 - 1.0)
   
   Serial.println("Audio I2S output initialized (internal DAC, mono on GPIO26)");
 }
 
-void playChime() {
-  Serial.println("Playing happy chimes...");
-  
-  // Stop any currently playing audio
-  if (wav != nullptr && wav->isRunning()) {
-    wav->stop();
+// Ask the audio task to play a sound; returns at once
+void playSound(SoundId sound) {
+  playSoundAt(sound, 1.0f);
+}
+
+void playSoundAt(SoundId sound, float gain) {
+  AudioRequest request = { sound, gain, "" };
+  if (sound == SOUND_TIME_TO_GO) {
+    portENTER_CRITICAL(&alertSoundLock);
+    strlcpy(request.file, alertSound, sizeof(request.file));
+    portEXIT_CRITICAL(&alertSoundLock);
   }
-  
-  // Clean up previous audio file source
-  if (audioFile != nullptr) {
-    delete audioFile;
-    audioFile = nullptr;
+  if (xQueueSend(audioQueue, &request, 0) != pdTRUE) {
+    Serial.printf("ERROR: Audio queue full, %s dropped\n", soundName(sound));
   }
-  
-  // Clean up previous WAV generator
-  if (wav != nullptr) {
-    delete wav;
-    wav = nullptr;
+}
+
+// ===== AUDIO TASK FUNCTIONS =====
+
+void startAudioTask() {
+  audioQueue = xQueueCreate(AUDIO_QUEUE_LEN, sizeof(AudioRequest));
+  if (!soundFile.startLoader(SOUND_LOADER_PRIORITY, AUDIO_TASK_CORE, SOUND_LOADER_STACK)) {
+    Serial.println("ERROR: Sound file loader not started, alerts use the bell");
   }
-  
-  // Create new file source from PROGMEM
-  audioFile = new AudioFileSourcePROGMEM(happyChimesWav, sizeof(happyChimesWav));
-  
-  // Create WAV generator and start playback
-  wav = new AudioGeneratorWAV();
-  if (!wav->begin(audioFile, audioOut)) {
-    Serial.println("ERROR: Could not start WAV playback");
-    delete wav;
-    wav = nullptr;
-    delete audioFile;
-    audioFile = nullptr;
-    return;
+  xTaskCreatePinnedToCore(audioTask, "audio", AUDIO_TASK_STACK, nullptr, AUDIO_TASK_PRIORITY,
+                          &audioTaskHandle, AUDIO_TASK_CORE);
+  Serial.printf("Audio task started on core %d\n", AUDIO_TASK_CORE);
+}
+
+void audioTask(void* param) {
+  AudioRequest request;
+  while (true) {
+    // Idle: sleep until asked to play. Playing, or waiting for a sound
+    // file to load: wake every period.
+    bool busy = audioPlaying || fileVoice >= 0;
+    TickType_t wait = busy ? pdMS_TO_TICKS(AUDIO_TASK_PERIOD_MS) : portMAX_DELAY;
+    if (xQueueReceive(audioQueue, &request, wait) == pdTRUE) {
+      startSound(request);
+    }
+    if (fileVoice >= 0) {
+      startFileVoice();
+    }
+    if (audioPlaying) {
+      pumpAudio();
+    }
+    publishAudioHealth();
   }
-  
+}
+
+// Start a sound on a mixer voice. The same sound playing again restarts
+// on its own voice (there is one file generator, so a sound file always
+// does); otherwise a free voice is taken, or the oldest one. A voice that
+// is cut short has what it queued faded out over a few ms, so it doesn't
+// click.
+void startSound(const AudioRequest& request) {
+  SoundId sound = request.sound;
+  bool fromFile = request.file[0] != '\0';
+  Serial.printf("Playing %s at gain %.2f...\n", fromFile ? request.file : soundName(sound), request.gain);
+
+  int v = -1;
+  for (int i = 0; i < MIXER_VOICES && v < 0; i++) {
+    const AudioVoice& voice = audioVoices[i];
+    if (voice.generator != nullptr && (voice.sound == sound || (fromFile && voice.generator == &fileGenerator))) {
+      v = i;
+    }
+  }
+  for (int i = 0; i < MIXER_VOICES && v < 0; i++) {
+    if (audioVoices[i].generator == nullptr) {
+      v = i;
+    }
+  }
+  if (v < 0) {
+    v = 0;
+    for (int i = 1; i < MIXER_VOICES; i++) {
+      if (audioVoices[i].startOrder < audioVoices[v].startOrder) {
+        v = i;
+      }
+    }
+  }
+
+  AudioVoice& voice = audioVoices[v];
+  PcmRing& ring = audioMixer.voice(v);
+  voice.out.SetGain(request.gain);
+  stopVoice(v);
+  audioMixer.setProducing(v, false);
+  if (audioPlaying) {
+    ring.fadeOut(dacRate * AUDIO_RETRIGGER_FADE_MS / 1000);
+  } else {
+    ring.clear();
+  }
+  voice.sound = sound;
+  voice.startOrder = ++audioStarts;
+
+  // A sound file starts once the loader has filled the read-ahead (see
+  // startFileVoice()); synthesized sounds render from their note data
+  if (fromFile) {
+    char path[SOUND_PATH_MAX];
+    snprintf(path, sizeof(path), "%s/%s", SOUND_DIR, request.file);
+    if (soundFile.open(path)) {
+      voice.generator = &fileGenerator;
+      fileVoice = v;
+      fileVoiceSince = millis();
+      return;
+    }
+    Serial.printf("ERROR: Could not open %s, playing %s\n", path, soundName(sound));
+  }
+  voice.generator = &voice.bell;
+  if (!voice.bell.begin(*synthSound(sound), &voice.out) || !startVoice(v)) {
+    Serial.printf("ERROR: Could not start %s\n", soundName(sound));
+    voice.generator = nullptr;
+  }
+}
+
+// Start the DAC for a voice whose generator has begun, and let the mixer
+// take from it. The DAC is only started (at the rate the generator set)
+// when it is not already running. The mixer doesn't resample, so a sound
+// at another rate retunes the DAC and cuts the other voices.
+bool startVoice(int v) {
+  AudioVoice& voice = audioVoices[v];
+  int rate = voice.out.rate();
+  if (!audioPlaying) {
+    if (!audioOut->SetRate(rate) || !audioOut->begin()) {
+      voice.generator->stop();
+      return false;
+    }
+    claimGpio25ForTouch();  // Starting the output may have enabled DAC channel 1
+  } else if (rate != dacRate) {
+    for (int i = 0; i < MIXER_VOICES; i++) {
+      if (i != v && audioVoices[i].generator != nullptr) {
+        stopVoice(i);
+        audioVoices[i].generator = nullptr;
+        audioMixer.setProducing(i, false);
+        audioMixer.voice(i).clear();
+      }
+    }
+    if (!audioOut->SetRate(rate)) {
+      voice.generator->stop();
+      return false;
+    }
+  }
+
+  audioMixer.setGain(v, soundGain(voice.sound));
+  audioMixer.setProducing(v, true);
+  dacRate = rate;
   audioPlaying = true;
-  Serial.printf("WAV playback started (size: %d bytes)\n", sizeof(happyChimesWav));
-}
-
-void audioLoop() {
-  // Handle audio playback - must be called frequently!
-  if (audioPlaying && wav != nullptr) {
-    if (wav->isRunning()) {
-      if (!wav->loop()) {
-        // Playback finished
-        wav->stop();
-        audioPlaying = false;
-        reinitTouch();  // Reinit touch after audio (I2S may have affected GPIO25)
-        Serial.println("WAV playback complete");
+
+  uint8_t playing = 0;
+  for (const AudioVoice& other : audioVoices) {
+    playing += other.generator != nullptr;
+  }
+  if (playing > mixerStats.voicesPeak) {
+    mixerStats.voicesPeak = playing;
+  }
+  Serial.printf("Playback started on voice %d at %d Hz (%u playing)\n", v, dacRate, playing);
+  return true;
+}
+
+// Stop what a voice is playing, or its wait for a sound file
+void stopVoice(int v) {
+  AudioVoice& voice = audioVoices[v];
+  if (v == fileVoice) {
+    soundFile.close();
+    fileVoice = -1;
+  } else if (voice.generator != nullptr && voice.generator->isRunning()) {
+    voice.generator->stop();  // The file generator's also closes soundFile
+  }
+}
+
+// Generators top up their voices and the mixer sums them into audioRing,
+// until the ring is full or a voice has nothing more ready
+void fillAudioRing() {
+  int16_t mixed[MIXER_CHUNK];
+  while (audioRing.space() > 0) {
+    for (int v = 0; v < MIXER_VOICES; v++) {
+      AudioVoice& voice = audioVoices[v];
+      if (voice.generator == nullptr || v == fileVoice) {
+        continue;
+      }
+      PcmRing& ring = audioMixer.voice(v);
+      uint32_t before = ring.available();
+      int64_t start = esp_timer_get_time();
+      bool running = voice.generator->isRunning() && voice.generator->loop();
+      uint32_t micros = esp_timer_get_time() - start;
+      audioHealth.decodeMicros += micros;
+      if (micros > audioHealth.worstDecodeMicros) {
+        audioHealth.worstDecodeMicros = micros;
+      }
+      audioHealth.samplesProduced += ring.available() - before;
+      audioMixer.setProducing(v, running);
+      if (!running && ring.available() == 0) {
+        voice.generator = nullptr;  // Played out: free
       }
-    } else {
-      audioPlaying = false;
-      reinitTouch();  // Reinit touch after audio
+    }
+
+    int want = min(audioRing.space(), (uint32_t)MIXER_CHUNK);
+    int64_t start = esp_timer_get_time();
+    int n = audioMixer.mix(mixed, want);
+    mixerStats.micros += esp_timer_get_time() - start;
+    mixerStats.samples += n;
+    for (int i = 0; i < n; i++) {
+      audioRing.push(mixed[i]);
+    }
+    if (n == 0) {
+      return;
     }
   }
 }
 
-// Reinitialize touch controller after audio playback
-// This is needed on the resistive board because I2S internal DAC uses GPIO25
-// which conflicts with the touch SPI clock
-void reinitTouch() {
+// One refill: mix until the ring is full and feed the DMA queue until it
+// is full. Playback ends when every voice is done and the ring is empty.
+void pumpAudio() {
+  static int64_t lastPumpMicros = 0;
+  int64_t now = esp_timer_get_time();
+  int64_t dmaMicros = 1000000LL * AUDIO_DMA_BUFFERS * AUDIO_DMA_BUFFER_FRAMES / dacRate;
+  if (lastPumpMicros != 0) {
+    uint32_t gap = now - lastPumpMicros;
+    if (gap > audioHealth.longestGapMicros) {
+      audioHealth.longestGapMicros = gap;
+    }
+    if (gap > dmaMicros) {
+      audioHealth.dmaUnderruns++;  // The DMA queue emptied before this refill (silence was played)
+    }
+  }
+  lastPumpMicros = now;
+
+  int16_t frame[2];
+  while (true) {
+    fillAudioRing();
+    if (!audioRing.peek(frame[0])) {
+      break;
+    }
+    do {
+      frame[1] = frame[0];
+      if (!audioOut->ConsumeSample(frame)) {
+        return;  // DMA queue full: the usual way out
+      }
+      audioRing.drop();
+      audioHealth.samplesPlayed++;
+    } while (audioRing.peek(frame[0]));
+  }
+
+  if (!audioMixer.idle()) {
+    audioHealth.ringUnderruns++;  // The DMA queue wanted more than the voices had ready
+    return;
+  }
+  audioOut->stop();
+  audioPlaying = false;
+  lastPumpMicros = 0;
+  Serial.println("Playback complete");
+}
+
+// Audio task, after each pass: copy the health counters and hand over the
+// pass's mixer stats, so each is read whole and none is lost to a reset
+void publishAudioHealth() {
+  portENTER_CRITICAL(&audioHealthLock);
+  audioHealthShared = audioHealth;
+  mixerStatsShared.micros += mixerStats.micros;
+  mixerStatsShared.samples += mixerStats.samples;
+  mixerStatsShared.voicesPeak = max(mixerStatsShared.voicesPeak, mixerStats.voicesPeak);
+  portEXIT_CRITICAL(&audioHealthLock);
+  mixerStats = MixerStats();
+}
+
+// The counters as of the audio task's last pass, from any task
+AudioHealth readAudioHealth() {
+  portENTER_CRITICAL(&audioHealthLock);
+  AudioHealth health = audioHealthShared;
+  portEXIT_CRITICAL(&audioHealthLock);
+  return health;
+}
+
+// The mixer stats since the last call, then start again
+MixerStats takeMixerStats() {
+  portENTER_CRITICAL(&audioHealthLock);
+  MixerStats stats = mixerStatsShared;
+  mixerStatsShared = MixerStats();
+  portEXIT_CRITICAL(&audioHealthLock);
+  return stats;
+}
+
+// The pipeline counters since boot (minute stats and 'a')
+void printAudioHealth() {
+  AudioHealth health = readAudioHealth();
+  Serial.printf("Audio: %u samples produced, %u played; underruns %u ring, %u DMA; %u limited\n",
+                health.samplesProduced, health.samplesPlayed, health.ringUnderruns, health.dmaUnderruns,
+                audioMixer.limited());
+  Serial.printf("Audio: longest gap between refills %u us (DMA queue lasts %u us); decode %u us per %d-sample buffer, worst loop() %u us\n",
+                health.longestGapMicros,
+                (unsigned)(1000000ULL * AUDIO_DMA_BUFFERS * AUDIO_DMA_BUFFER_FRAMES / (dacRate ? dacRate : BELL_RATE)),
+                health.decodeMicrosPer(AUDIO_DMA_BUFFER_FRAMES), AUDIO_DMA_BUFFER_FRAMES, health.worstDecodeMicros);
+}
+
+// Give GPIO25 back to touch after the I2S driver has started. The speaker
+// is on GPIO26 (DAC channel 2) and mono output only needs that channel, so
+// channel 1 is gated off and the pad returned to the GPIO matrix: a few
+// register writes instead of tearing down the touch bus, and touch keeps
+// working while a sound plays.
+void claimGpio25ForTouch() {
+  xSemaphoreTake(touchBusMutex, portMAX_DELAY);
+  dac_output_disable(DAC_CHANNEL_1);
 #if defined(BOARD_CYD_RESISTIVE)
-  // Reinitialize the HSPI bus for touch
-  touchSPI.end();
-  delay(10);
-  touchSPI.begin(TOUCH_SCLK, TOUCH_MISO, TOUCH_MOSI, TOUCH_CS);
-  ts.begin(touchSPI);
-  ts.setRotation(1);
-  Serial.println("Touch controller reinitialized");
+  // Re-routes HSPI SCLK to the pad (pinMode() also detaches the RTC/analog
+  // function the DAC put on it)
+  spiAttachSCK(touchSPI.bus(), TOUCH_SCLK);
+#elif defined(BOARD_CYD_CAPACITIVE)
+  // Reset line back to an output, held high (not in reset)
+  pinMode(TOUCH_RST, OUTPUT);
+  digitalWrite(TOUCH_RST, HIGH);
 #endif
-  // Capacitive touch uses I2C, no conflict with I2S DAC
+  xSemaphoreGive(touchBusMutex);
+  gpio25Reclaims++;
+}
+
+// ===== SOUND FILE FUNCTIONS =====
+
+// Start the voice waiting on soundFile once the read-ahead is full. A
+// missing or unreadable file, or a loader that doesn't fill it in time,
+// plays the synthesized sound instead: an alert is never silent.
+void startFileVoice() {
+  int v = fileVoice;
+  AudioVoice& voice = audioVoices[v];
+  if (soundFile.ready()) {
+    fileVoice = -1;
+    if (fileGenerator.begin(soundFile.info(), &soundFile, &voice.out) && startVoice(v)) {
+      return;
+    }
+    soundFile.close();
+  } else if (!soundFile.failed() && millis() - fileVoiceSince < SOUND_FILE_START_TIMEOUT_MS) {
+    return;  // Still loading
+  } else {
+    stopVoice(v);
+  }
+
+  Serial.printf("ERROR: Sound file did not start, playing %s\n", soundName(voice.sound));
+  voice.generator = &voice.bell;
+  if (!voice.bell.begin(*synthSound(voice.sound), &voice.out) || !startVoice(v)) {
+    Serial.printf("ERROR: Could not start %s\n", soundName(voice.sound));
+    voice.generator = nullptr;
+  }
+}
+
+void loadAlertSound() {
+  preferences.begin("nigel-timer", true);
+  String name = preferences.getString(ALERT_SOUND_KEY, "");
+  preferences.end();
+  portENTER_CRITICAL(&alertSoundLock);
+  strlcpy(alertSound, name.c_str(), sizeof(alertSound));
+  portEXIT_CRITICAL(&alertSoundLock);
+  Serial.printf("Alert sound: %s\n", alertSound[0] ? alertSound : "synthesized bell");
+}
+
+// 'f': step through the bell and the files in SOUND_DIR in name order,
+// save the choice and play it
+void selectNextAlertSound() {
+  char next[SOUND_NAME_MAX] = "";  // Smallest name after the current one; none: back to the bell
+  fs::File dir = LittleFS.open(SOUND_DIR);
+  if (dir && dir.isDirectory()) {
+    for (fs::File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+      const char* name = entry.name();
+      if (!entry.isDirectory() && strlen(name) < sizeof(next) && strcmp(name, alertSound) > 0 &&
+          (next[0] == '\0' || strcmp(name, next) < 0)) {
+        strcpy(next, name);
+      }
+    }
+  } else {
+    Serial.printf("No %s directory: upload one with pio run -t uploadfs\n", SOUND_DIR);
+  }
+
+  portENTER_CRITICAL(&alertSoundLock);
+  strcpy(alertSound, next);
+  portEXIT_CRITICAL(&alertSoundLock);
+  preferences.begin("nigel-timer", false);
+  preferences.putString(ALERT_SOUND_KEY, alertSound);
+  preferences.end();
+  Serial.printf("Alert sound: %s\n", alertSound[0] ? alertSound : "synthesized bell");
+  playSound(SOUND_TIME_TO_GO);
+}
+
+// How long 'bytes' of the read-ahead play for, in ms
+uint32_t readAheadMs(uint32_t bytes) {
+  ImaWavInfo info = soundFile.info();
+  if (info.blockAlign == 0 || info.sampleRate == 0) {
+    return 0;
+  }
+  bytes = min(bytes, soundFile.bufferBytes());
+  return (uint64_t)bytes * info.samplesPerBlock * 1000 / info.blockAlign / info.sampleRate;
+}
+
+// 'w': play the alert file with log-sized appends hammering LittleFS
+// every FLASH_STRESS_INTERVAL_MS, then report the loader's worst read
+// against what the read-ahead holds. Playback is clean if the read-ahead
+// never ran dry and neither underrun counter moved.
+uint32_t stressRingUnderruns = 0;
+uint32_t stressDmaUnderruns = 0;
+uint32_t stressAppends = 0;
+uint32_t stressWorstAppendMicros = 0;
+
+void startFlashStress() {
+  if (alertSound[0] == '\0') {
+    Serial.println("Flash stress: choose a sound file first (f)");
+    return;
+  }
+  soundFile.takeStats();
+  AudioHealth health = readAudioHealth();
+  stressRingUnderruns = health.ringUnderruns;
+  stressDmaUnderruns = health.dmaUnderruns;
+  stressAppends = stressWorstAppendMicros = 0;
+  playSound(SOUND_TIME_TO_GO);
+  flashStressUntil = millis() + FLASH_STRESS_MS;
+  Serial.printf("Flash stress: playing %s, appending to %s every %lu ms\n", alertSound,
+                FLASH_STRESS_PATH, FLASH_STRESS_INTERVAL_MS);
+}
+
+void runFlashStress() {
+  static unsigned long lastAppendMillis = 0;
+  if ((long)(millis() - flashStressUntil) < 0) {
+    if (millis() - lastAppendMillis >= FLASH_STRESS_INTERVAL_MS) {
+      lastAppendMillis = millis();
+      int64_t start = esp_timer_get_time();
+      appendLine(FLASH_STRESS_PATH, "10/15/26 04:12 AM -- Duration: 03:58:41");
+      uint32_t micros = esp_timer_get_time() - start;
+      stressWorstAppendMicros = max(stressWorstAppendMicros, micros);
+      stressAppends++;
+    }
+    return;
+  }
+
+  flashStressUntil = 0;
+  LittleFS.remove(FLASH_STRESS_PATH);
+  AudioFileSourceReadAhead::Stats stats = soundFile.takeStats();
+  AudioHealth health = readAudioHealth();
+  Serial.printf("Flash stress: %u appends, worst %u us\n", stressAppends, stressWorstAppendMicros);
+  Serial.printf("  loader: %u chunks, worst read %u us (open %u us)\n",
+                stats.chunks, stats.worstReadMicros, stats.worstOpenMicros);
+  Serial.printf("  read-ahead: %u ms buffered, lowest %u ms, starved %u\n",
+                readAheadMs(soundFile.bufferBytes()), readAheadMs(stats.lowWater), stats.starved);
+  Serial.printf("  underruns during the test: %u ring, %u DMA -> %s\n",
+                health.ringUnderruns - stressRingUnderruns, health.dmaUnderruns - stressDmaUnderruns,
+                stats.starved == 0 && health.ringUnderruns == stressRingUnderruns &&
+                health.dmaUnderruns == stressDmaUnderruns ? "clean" : "NOT clean");
 }
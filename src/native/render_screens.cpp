@@ -0,0 +1,163 @@
+// ===== HOST SCREEN RENDERER =====
+// Drives the real screens and compositor through a fixed sequence of frames
+// against the framebuffer emulator (lib/tft_emu). For each frame it prints
+// the dirty rectangles, the bytes that would have crossed SPI and a hash of
+// the framebuffer, so a redraw regression shows up as a changed line. Touch
+// hit tests and the draw profile follow (profile times are host times,
+// useful only relative to each other).
+//
+//   pio run -e native && .pio/build/native/program [ppm-dir]
+//
+// Every frame and hit test is checked against the golden values in FRAMES
+// and PROBES; any difference is marked and the program exits 1. After an
+// intended change to the screens, check the frames (write them as PPM
+// images with a directory argument) and copy the new values into the tables.
+
+#include <TFT_eSPI.h>
+#include "../screens.h"
+#include "../profiler.h"
+#include "../audio_health.h"
+
+TFT_eSPI tft;
+Compositor compositor;
+
+struct Frame {
+  const char* name;
+  void (*prepare)();
+  const Screen* screen;
+  // Golden values
+  int rects;
+  uint32_t pixels;
+  uint64_t spiBytes;
+  uint32_t hash;
+};
+
+static void running(unsigned long seconds, uint16_t bgColor) {
+  applyTheme(bgColor);
+  runningTimer.setSeconds(seconds);
+}
+
+static const char* SAMPLE_LOGS[] = {
+  "10/15/26 04:12 AM -- Duration: 03:58:41",
+  "10/15/26 12:13 AM -- Duration: 04:02:10",
+  "10/14/26 08:11 PM Boot",
+};
+
+// A night with one glitch, as the logs screen would show it
+static void sampleAudioHealth() {
+  AudioHealth health;
+  health.samplesProduced = health.samplesPlayed = 22050 * 40;
+  health.dmaUnderruns = 1;
+  health.longestGapMicros = 52300;
+  health.decodeMicros = 3200000;
+  char text[64];
+  formatAudioHealth(health, 128, text, sizeof(text));
+  setAudioHealth(text, health.underruns() == 0);
+}
+
+static const Frame FRAMES[] = {
+  { "waiting", [] { applyTheme(COLOR_RED); clockWidget.setText("10:42PM"); }, &waitingScreen, 1, 76800, 167988, 0xe9a9cd0f },
+  { "start", [] { running(0, COLOR_RED); }, &runningScreen, 2, 18288, 36609, 0xf3681ebf },
+  { "tick", [] { running(1, COLOR_RED); }, &runningScreen, 0, 1320, 2651, 0x910deca7 },
+  { "minute-rollover", [] { running(60, COLOR_RED); }, &runningScreen, 0, 2640, 5302, 0xb6be8147 },
+  { "clock-minute", [] { running(61, COLOR_RED); clockWidget.setText("10:43PM"); }, &runningScreen, 1, 4320, 8838, 0x49b643cf },
+  { "hour-rollover", [] { running(3600, COLOR_RED); }, &runningScreen, 0, 3960, 7953, 0xd0b8ae97 },
+  { "to-yellow", [] { running(12600, COLOR_YELLOW); }, &runningScreen, 1, 76800, 160365, 0xe391e5f8 },
+  { "to-blue", [] { running(14400, COLOR_BLUE); }, &runningScreen, 1, 76800, 160365, 0x9f87858f },
+  { "logs", [] { setLogLines(SAMPLE_LOGS, 3); sampleAudioHealth(); }, &logsScreen, 1, 76800, 161861, 0x0b87cbd5 },
+  { "logs-cleared", [] { setLogLines(nullptr, 0); }, &logsScreen, 4, 9696, 26289, 0x9a2d3c4d },
+  { "back-to-timer", [] { running(14401, COLOR_BLUE); }, &runningScreen, 1, 76800, 160365, 0xa538eb57 },
+  { "reset", [] { running(0, COLOR_RED); }, &runningScreen, 1, 76800, 160365, 0x555a130f },
+  { "idle-tick", [] { running(0, COLOR_RED); }, &runningScreen, 0, 0, 0, 0x555a130f },
+};
+
+struct Probe {
+  const char* name;
+  const Screen* screen;
+  int16_t x, y;
+  int action;  // Golden TouchAction
+};
+
+// One tap per target plus a miss on each screen, to catch layout changes
+// that move a button away from where it is drawn
+static const Probe PROBES[] = {
+  { "waiting/logs", &waitingScreen, 285, 220, ACTION_OPEN_LOGS },
+  { "waiting/miss", &waitingScreen, 160, 120, ACTION_TIMER },
+  { "running/logs", &runningScreen, 250, 200, ACTION_OPEN_LOGS },
+  { "running/timer", &runningScreen, 160, 155, ACTION_TIMER },
+  { "logs/clear", &logsScreen, 45, 215, ACTION_CLEAR_LOGS },
+  { "logs/test", &logsScreen, 275, 215, ACTION_TEST_CHIME },
+  { "logs/miss", &logsScreen, 160, 120, ACTION_CLOSE_LOGS },
+};
+
+int main(int argc, char** argv) {
+  const char* ppmDir = argc > 1 ? argv[1] : nullptr;
+
+  tft.init();
+  tft.setRotation(1);
+  if (!beginScreens(tft)) {
+    fprintf(stderr, "ERROR: Timer sprite allocation failed\n");
+    return 1;
+  }
+  initDisplayDMA(tft);
+  tft.resetSpiStats();
+
+  printf("%-3s %-16s %5s %9s %10s %10s\n", "#", "frame", "rects", "px", "spi bytes", "hash");
+  uint64_t totalBytes = 0;
+  int mismatches = 0;
+  int count = sizeof(FRAMES) / sizeof(FRAMES[0]);
+  for (int i = 0; i < count; i++) {
+    const Frame& frame = FRAMES[i];
+    uint64_t before = tft.spiBytes();
+    frame.prepare();
+    compositor.render(tft, *frame.screen);
+    uint64_t bytes = tft.spiBytes() - before;
+    totalBytes += bytes;
+
+    uint32_t hash = tft.framebufferHash();
+    bool match = compositor.lastDirtyRects() == frame.rects && compositor.lastPixels() == frame.pixels &&
+                 bytes == frame.spiBytes && hash == frame.hash;
+    printf("%-3d %-16s %5d %9u %10llu   %08x", i, frame.name, compositor.lastDirtyRects(),
+           compositor.lastPixels(), (unsigned long long)bytes, hash);
+    if (match) {
+      printf("\n");
+    } else {
+      printf("   MISMATCH, expected %d %u %llu %08x\n", frame.rects, frame.pixels,
+             (unsigned long long)frame.spiBytes, frame.hash);
+      mismatches++;
+    }
+
+    if (ppmDir != nullptr) {
+      char path[256];
+      snprintf(path, sizeof(path), "%s/%02d-%s.ppm", ppmDir, i, frame.name);
+      if (!tft.writePPM(path)) {
+        fprintf(stderr, "ERROR: Could not write %s\n", path);
+        return 1;
+      }
+    }
+  }
+
+  printf("\nHit tests (action ids from TouchAction):\n");
+  for (const Probe& probe : PROBES) {
+    int action = probe.screen->hitTest(probe.x, probe.y);
+    printf("  %-14s (%3d,%3d) -> %d", probe.name, probe.x, probe.y, action);
+    if (action == probe.action) {
+      printf("\n");
+    } else {
+      printf("   MISMATCH, expected %d\n", probe.action);
+      mismatches++;
+    }
+  }
+
+  printf("\nSPI bytes by call (all frames):\n");
+  tft.printSpiStats(stdout);
+  printf("\n");
+  profileDump([](const char* line) { printf("%s\n", line); });
+
+  if (mismatches > 0) {
+    fprintf(stderr, "ERROR: %d frame(s) or hit test(s) differ from the golden values\n", mismatches);
+    return 1;
+  }
+  printf("\nAll frames and hit tests match the golden values\n");
+  return 0;
+}
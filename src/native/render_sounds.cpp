@@ -0,0 +1,223 @@
+// ===== HOST SOUND RENDERER =====
+// Renders every synthesized alert sound (sounds.cpp) through BellSynth into
+// a PCM buffer and prints its length, peak and how many samples clipped,
+// then times repeated renders for the cost per sample. The mixer is timed
+// the same way with 1 to MIXER_VOICES voices of the longest sound, and
+// checked on overlaps that start and stop mid-sound for clipped samples
+// and for steps: a mixed sample that moves further than the sum of its
+// voices did, as when one voice starting changes the level of another.
+// Exits 1 on any clipped sample or step. Host times are only useful
+// relative to each other: a change that doubles the ns/sample here will
+// roughly double its share of the audio task too.
+//
+//   pio run -e native_sounds && .pio/build/native_sounds/program [wav-dir] [repeat]
+//
+// With a directory argument every sound is also written as a 16-bit mono
+// WAV, to listen to.
+
+#include <Arduino.h>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "../sounds.h"
+#include "../audio_mixer.h"
+
+static const int RENDER_CHUNK = 64;  // Samples per render() call, as the audio task asks
+
+static void put16(FILE* f, uint16_t v) { fputc(v & 0xFF, f); fputc(v >> 8, f); }
+static void put32(FILE* f, uint32_t v) { put16(f, v & 0xFFFF); put16(f, v >> 16); }
+
+static bool writeWav(const char* path, const std::vector<int16_t>& pcm) {
+  FILE* f = fopen(path, "wb");
+  if (f == nullptr) {
+    return false;
+  }
+  uint32_t bytes = pcm.size() * 2;
+  fwrite("RIFF", 1, 4, f); put32(f, 36 + bytes); fwrite("WAVEfmt ", 1, 8, f);
+  put32(f, 16); put16(f, 1); put16(f, 1); put32(f, BELL_RATE); put32(f, BELL_RATE * 2);
+  put16(f, 2); put16(f, 16);
+  fwrite("data", 1, 4, f); put32(f, bytes);
+  for (int16_t s : pcm) {
+    put16(f, (uint16_t)s);
+  }
+  return fclose(f) == 0;
+}
+
+static std::vector<int16_t> render(BellSynth& synth, const BellSound& sound) {
+  std::vector<int16_t> pcm;
+  int16_t chunk[RENDER_CHUNK];
+  synth.start(sound);
+  int n;
+  while ((n = synth.render(chunk, RENDER_CHUNK)) > 0) {
+    pcm.insert(pcm.end(), chunk, chunk + n);
+  }
+  return pcm;
+}
+
+// Mix 'pcm' on 'voices' voices (each voice offset by a little, as sounds
+// started a moment apart would be), 'repeat' times over. Returns ns/sample.
+static double timeMixer(const std::vector<int16_t>& pcm, int voices, int repeat) {
+  double ns = 0;
+  size_t mixed = 0;
+  int16_t out[MIXER_CHUNK];
+  for (int r = 0; r < repeat; r++) {
+    AudioMixer mixer;
+    size_t fed[MIXER_VOICES] = {};
+    for (int v = 0; v < voices; v++) {
+      fed[v] = v * 1000;
+      mixer.setGain(v, soundGain(SOUND_TIME_TO_GO));
+      mixer.setProducing(v, true);
+    }
+    while (true) {
+      for (int v = 0; v < voices; v++) {
+        while (fed[v] < pcm.size() && mixer.voice(v).push(pcm[fed[v]])) {
+          fed[v]++;
+        }
+        mixer.setProducing(v, fed[v] < pcm.size());
+      }
+      auto begin = std::chrono::steady_clock::now();
+      int n = mixer.mix(out, MIXER_CHUNK);
+      ns += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+      mixed += n;
+      if (n == 0) {
+        break;
+      }
+    }
+  }
+  return mixed ? ns / mixed : 0;
+}
+
+// One sound on one voice of a checked mix, joining 'at' samples in (the
+// first at 0, and each before the ones already playing have ended)
+struct Track {
+  const std::vector<int16_t>* pcm;
+  SoundId sound;
+  size_t at;
+};
+
+// Mix 'tracks', each joining at its start, and compare every output sample
+// with the plain sum of the voices (gains applied). Headroom and the
+// limiter have a slope of at most 1, so the output may never move further
+// between two samples than that sum did; a jump past it is a step.
+static void checkMix(const Track* tracks, int count, uint32_t& clipped, uint32_t& steps, uint32_t& limited) {
+  AudioMixer mixer;
+  size_t started[MIXER_VOICES] = {};  // Output position the voice joined at (a chunk boundary)
+  size_t fed[MIXER_VOICES] = {};
+  bool joined[MIXER_VOICES] = {};
+  int16_t out[MIXER_CHUNK];
+  size_t pos = 0;
+  double lastSum = 0;
+  int lastOut = 0;
+  clipped = steps = 0;
+  while (true) {
+    for (int v = 0; v < count; v++) {
+      const std::vector<int16_t>& pcm = *tracks[v].pcm;
+      if (!joined[v] && pos >= tracks[v].at) {
+        joined[v] = true;
+        started[v] = pos;
+        mixer.setGain(v, soundGain(tracks[v].sound));
+      }
+      while (joined[v] && fed[v] < pcm.size() && mixer.voice(v).push(pcm[fed[v]])) {
+        fed[v]++;
+      }
+      mixer.setProducing(v, joined[v] && fed[v] < pcm.size());
+    }
+    int n = mixer.mix(out, MIXER_CHUNK);
+    if (n == 0) {
+      break;
+    }
+    for (int i = 0; i < n; i++, pos++) {
+      double sum = 0;
+      for (int v = 0; v < count; v++) {
+        const std::vector<int16_t>& pcm = *tracks[v].pcm;
+        if (joined[v] && pos >= started[v] && pos - started[v] < pcm.size()) {
+          sum += pcm[pos - started[v]] * soundGain(tracks[v].sound) / 256.0;
+        }
+      }
+      clipped += (out[i] == 32767 || out[i] == -32768);
+      if (abs(out[i] - lastOut) > fabs(sum - lastSum) + 2) {
+        steps++;
+      }
+      lastSum = sum;
+      lastOut = out[i];
+    }
+  }
+  limited = mixer.limited();
+}
+
+int main(int argc, char** argv) {
+  const char* wavDir = argc > 1 ? argv[1] : nullptr;
+  int repeat = argc > 2 ? atoi(argv[2]) : 50;
+  BellSynth synth;
+  uint32_t clippedTotal = 0;
+
+  printf("%-12s %5s %8s %7s %6s %7s %10s %9s\n", "sound", "notes", "samples", "ms", "peak", "clipped", "ns/sample", "realtime");
+  for (int id = 0; id < SOUND_COUNT; id++) {
+    const BellSound* sound = synthSound((SoundId)id);
+    std::vector<int16_t> pcm = render(synth, *sound);
+    int peak = 0, clipped = 0;
+    for (int16_t s : pcm) {
+      peak = max(peak, abs((int)s));
+      clipped += (s == 32767 || s == -32768);
+    }
+    clippedTotal += clipped;
+
+    auto begin = std::chrono::steady_clock::now();
+    size_t total = 0;
+    for (int i = 0; i < repeat; i++) {
+      total += render(synth, *sound).size();
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+    double nsPerSample = total ? ns / total : 0;
+
+    printf("%-12s %5d %8zu %7.0f %6d %7d %10.1f %8.0fx\n", soundName((SoundId)id), sound->count, pcm.size(),
+           pcm.size() * 1000.0 / BELL_RATE, peak, clipped, nsPerSample,
+           nsPerSample > 0 ? 1e9 / BELL_RATE / nsPerSample : 0);
+
+    if (wavDir != nullptr) {
+      char path[256];
+      snprintf(path, sizeof(path), "%s/%s.wav", wavDir, soundName((SoundId)id));
+      if (!writeWav(path, pcm)) {
+        fprintf(stderr, "ERROR: Could not write %s\n", path);
+        return 1;
+      }
+    }
+  }
+
+  std::vector<int16_t> bell = render(synth, *synthSound(SOUND_TIME_TO_GO));
+  printf("\n%-12s %10s\n", "mixer", "ns/sample");
+  for (int voices = 1; voices <= MIXER_VOICES; voices++) {
+    printf("%d voice%-5s %10.1f\n", voices, voices > 1 ? "s" : "", timeMixer(bell, voices, repeat));
+  }
+
+  // The bell with the reset tick over it, two warnings over it, and three
+  // bells a moment apart (the loudest overlap there is)
+  std::vector<int16_t> warning = render(synth, *synthSound(SOUND_WARNING));
+  std::vector<int16_t> click = render(synth, *synthSound(SOUND_RESET_CLICK));
+  static const struct {
+    const char* name;
+    Track tracks[MIXER_VOICES];
+    int count;
+  } MIXES[] = {
+    { "bell+tick", { { &bell, SOUND_TIME_TO_GO, 0 }, { &click, SOUND_RESET_CLICK, 5003 } }, 2 },
+    { "bell+warning", { { &bell, SOUND_TIME_TO_GO, 0 }, { &warning, SOUND_WARNING, 11025 },
+                        { &warning, SOUND_WARNING, 40000 } }, 3 },
+    { "3 bells", { { &bell, SOUND_TIME_TO_GO, 0 }, { &bell, SOUND_TIME_TO_GO, 1000 },
+                   { &bell, SOUND_TIME_TO_GO, 2000 } }, 3 },
+  };
+  uint32_t stepsTotal = 0;
+  printf("\n%-12s %8s %8s %8s\n", "overlap", "clipped", "steps", "limited");
+  for (const auto& mix : MIXES) {
+    uint32_t clipped, steps, limited;
+    checkMix(mix.tracks, mix.count, clipped, steps, limited);
+    printf("%-12s %8u %8u %8u\n", mix.name, clipped, steps, limited);
+    clippedTotal += clipped;
+    stepsTotal += steps;
+  }
+
+  if (clippedTotal > 0 || stepsTotal > 0) {
+    fprintf(stderr, "ERROR: %u samples clipped, %u steps\n", clippedTotal, stepsTotal);
+    return 1;
+  }
+  return 0;
+}
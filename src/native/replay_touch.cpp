@@ -0,0 +1,118 @@
+// ===== HOST TOUCH REPLAY =====
+// Feeds a recorded touch trace (see touch_trace.h; send 't' on the board to
+// record one and 'd' to dump it) through the same TouchPipeline, debounce
+// and timer state machine as the board, on a virtual clock that follows the
+// trace. Every gesture and every effect is printed with its trace time, so
+// a misbehaving sequence (a double reset, say) can be replayed and stepped
+// through without a finger on the glass. The trace is then replayed
+// 'repeat' more times with output off to time the input path on the host.
+//
+//   pio run -e native_replay && .pio/build/native_replay/program trace.trc [repeat]
+
+#include <TFT_eSPI.h>
+#include "../screens.h"
+#include "../timer_app.h"
+#include "../touch_trace.h"
+
+TFT_eSPI tft;
+
+static int64_t nowMicros = 0;  // Virtual clock: the time of the sample being fed
+static int gestureCounts[GESTURE_SWIPE_DOWN + 1];
+static int logLines = 0;
+
+static void stamp() {
+  Serial.printf("[%9.3f] ", nowMicros / 1e6);
+}
+
+// ===== PLATFORM =====
+int64_t platformMicros() { return nowMicros; }
+
+void logEntry(const char* message) {
+  logLines++;
+  stamp();
+  Serial.printf("LOG: %s\n", message);
+}
+
+void clearLogs() { stamp(); Serial.println("logs cleared"); }
+void playSound(SoundId sound) { stamp(); Serial.printf("sound: %s\n", soundName(sound)); }
+uint8_t scheduleAlarms(int64_t startMicros, uint8_t fired) {
+  uint8_t replaced = alarmsFiredThisSession;
+  timerStartMicros = startMicros;
+  alarmsFiredThisSession = fired;
+  return replaced;
+}
+void startTicks() { stamp(); Serial.printf("running screen, %lu s\n", getElapsedSeconds()); }
+void stopTicks() {}
+void showWaitingScreen() { stamp(); Serial.println("waiting screen"); }
+void showLogsScreen() { stamp(); Serial.println("logs screen"); }
+void onResetLogged(int64_t irqMicros, int64_t handlerMicros) {}
+
+static void dispatch(const TouchEvent& event) {
+  gestureCounts[event.gesture]++;
+  stamp();
+  Serial.printf("%s at (%d,%d)\n", gestureName(event.gesture), event.x, event.y);
+  dispatchTouch(event);
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s trace.trc [repeat]\n", argv[0]);
+    return 1;
+  }
+  int repeat = argc > 2 ? atoi(argv[2]) : 1000;
+
+  FILE* file = fopen(argv[1], "r");
+  if (file == nullptr) {
+    fprintf(stderr, "ERROR: Could not open %s\n", argv[1]);
+    return 1;
+  }
+  static TouchSample samples[100000];
+  int count = 0;
+  char line[128];
+  while (count < 100000 && fgets(line, sizeof(line), file) != nullptr) {
+    if (parseTouchSample(line, samples[count])) {
+      count++;
+    }
+  }
+  fclose(file);
+  if (count == 0) {
+    fprintf(stderr, "ERROR: No samples in %s\n", argv[1]);
+    return 1;
+  }
+
+  // The hit-test tables come with the screens
+  tft.init();
+  tft.setRotation(1);
+  beginScreens(tft);
+
+  // Each pass starts a minute after the previous one ended, past any debounce
+  int64_t passMicros = (int64_t)(samples[count - 1].ms - samples[0].ms) * 1000 + 60000000;
+  TouchPipeline pipeline(dispatch);
+  for (int i = 0; i < count; i++) {
+    nowMicros = (int64_t)(samples[i].ms - samples[0].ms) * 1000;
+    pipeline.feed(samples[i], nowMicros);
+  }
+
+  printf("\n%d samples, %d log lines; gestures:", count, logLines);
+  for (int g = GESTURE_TAP; g <= GESTURE_SWIPE_DOWN; g++) {
+    if (gestureCounts[g] > 0) {
+      printf(" %s=%d", gestureName((GestureType)g), gestureCounts[g]);
+    }
+  }
+  printf("\n");
+
+  if (repeat > 0) {
+    Serial.setOutput(nullptr);
+    unsigned long start = micros();
+    for (int pass = 1; pass <= repeat; pass++) {
+      for (int i = 0; i < count; i++) {
+        nowMicros = pass * passMicros + (int64_t)(samples[i].ms - samples[0].ms) * 1000;
+        pipeline.feed(samples[i], nowMicros);
+      }
+    }
+    unsigned long elapsed = micros() - start;
+    printf("Input path: %d passes, %.1f ns per sample (host)\n", repeat,
+           elapsed * 1000.0 / ((double)repeat * count));
+  }
+  return 0;
+}
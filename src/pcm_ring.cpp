@@ -0,0 +1,39 @@
+#include "pcm_ring.h"
+
+PcmRing::PcmRing(int16_t* storage, uint32_t capacity) : samples_(storage), mask_(capacity - 1) {}
+
+bool PcmRing::push(int16_t sample) {
+  if (available() > mask_) {
+    return false;
+  }
+  samples_[head_ & mask_] = sample;
+  head_ = head_ + 1;
+  return true;
+}
+
+bool PcmRing::peek(int16_t &sample) const {
+  if (head_ == tail_) {
+    return false;
+  }
+  sample = samples_[tail_ & mask_];
+  return true;
+}
+
+uint32_t PcmRing::read(int16_t* out, uint32_t count) {
+  uint32_t n = available() < count ? available() : count;
+  uint32_t tail = tail_;
+  for (uint32_t i = 0; i < n; i++) {
+    out[i] = samples_[(tail + i) & mask_];
+  }
+  tail_ = tail + n;
+  return n;
+}
+
+void PcmRing::fadeOut(uint32_t samples) {
+  uint32_t count = available() < samples ? available() : samples;
+  for (uint32_t i = 0; i < count; i++) {
+    int16_t &sample = samples_[(tail_ + i) & mask_];
+    sample = (int32_t)sample * (int32_t)(count - i) / (int32_t)(count + 1);
+  }
+  head_ = tail_ + count;
+}
@@ -0,0 +1,34 @@
+#pragma once
+// ===== PCM RING BUFFER =====
+// Fixed-size ring of mono 16-bit samples, used between the generators and
+// the mixer and between the mixer and the I2S DMA queue. One writer and one
+// reader; indices only ever grow (mod 2^32), so full and empty are told
+// apart without a spare slot. The caller provides the storage.
+
+#include <Arduino.h>
+
+class PcmRing {
+public:
+  PcmRing(int16_t* storage, uint32_t capacity);  // Capacity: a power of two
+
+  bool push(int16_t sample);
+  bool peek(int16_t &sample) const;
+  void drop() { tail_++; }  // After a successful peek()
+  uint32_t read(int16_t* out, uint32_t count);  // Up to 'count'; returns how many
+  void clear() { tail_ = head_; }
+
+  // Keep only the next 'samples' samples, ramped linearly down to silence,
+  // so a sound can be cut short without a click. Writer and reader must not
+  // run concurrently with this.
+  void fadeOut(uint32_t samples);
+
+  uint32_t capacity() const { return mask_ + 1; }
+  uint32_t available() const { return head_ - tail_; }
+  uint32_t space() const { return capacity() - available(); }
+
+private:
+  int16_t* samples_;
+  uint32_t mask_;
+  volatile uint32_t head_ = 0;  // Next write
+  volatile uint32_t tail_ = 0;  // Next read
+};
@@ -0,0 +1,84 @@
+#include "profiler.h"
+
+// Log-linear buckets: values below 4 us get their own bucket, above that
+// each power of two is split into 4, so a bucket is at most 25% wide.
+// 92 buckets reach past 16 s.
+const int PROFILE_SUB_BUCKETS = 4;
+const int PROFILE_BUCKETS = 92;
+
+struct ProfileEntry {
+  uint32_t count;
+  uint32_t minMicros;
+  uint32_t maxMicros;
+  uint64_t sumMicros;
+  uint32_t buckets[PROFILE_BUCKETS];
+};
+
+static ProfileEntry profileTable[PROF_SLOTS];
+
+static const char* const PROFILE_NAMES[PROF_SLOTS] = {
+  "waitingScreen", "timerDisplay", "logsScreen", "composite",
+  "labelPaint", "buttonPaint", "clockPaint", "timerPaint", "timerUpdate",
+};
+
+static int bucketFor(uint32_t us) {
+  if (us < PROFILE_SUB_BUCKETS) {
+    return us;
+  }
+  int exp = 31 - __builtin_clz(us);  // us >= 4, so exp >= 2
+  int sub = (us >> (exp - 2)) & (PROFILE_SUB_BUCKETS - 1);
+  return min(PROFILE_SUB_BUCKETS + (exp - 2) * PROFILE_SUB_BUCKETS + sub, PROFILE_BUCKETS - 1);
+}
+
+// Largest value that falls in a bucket
+static uint32_t bucketLimit(int bucket) {
+  if (bucket < PROFILE_SUB_BUCKETS) {
+    return bucket;
+  }
+  int exp = (bucket - PROFILE_SUB_BUCKETS) / PROFILE_SUB_BUCKETS + 2;
+  int sub = (bucket - PROFILE_SUB_BUCKETS) % PROFILE_SUB_BUCKETS;
+  return ((uint32_t)(PROFILE_SUB_BUCKETS + sub + 1) << (exp - 2)) - 1;
+}
+
+void profileRecord(ProfileSlot slot, uint32_t us) {
+  ProfileEntry& e = profileTable[slot];
+  if (e.count == 0 || us < e.minMicros) {
+    e.minMicros = us;
+  }
+  e.maxMicros = max(e.maxMicros, us);
+  e.sumMicros += us;
+  e.count++;
+  e.buckets[bucketFor(us)]++;
+}
+
+void profileReset() {
+  memset(profileTable, 0, sizeof(profileTable));
+}
+
+void profileDump(void (*emit)(const char* line)) {
+  char line[96];
+  emit("Profile (us):   count      min      avg      p99      max");
+  for (int slot = 0; slot < PROF_SLOTS; slot++) {
+    const ProfileEntry& e = profileTable[slot];
+    if (e.count == 0) {
+      continue;
+    }
+
+    // p99 is reported as the top of the bucket it falls in, capped at max
+    uint32_t rank = e.count - e.count / 100;
+    uint32_t seen = 0;
+    uint32_t p99 = e.maxMicros;
+    for (int b = 0; b < PROFILE_BUCKETS; b++) {
+      seen += e.buckets[b];
+      if (seen >= rank) {
+        p99 = min(bucketLimit(b), e.maxMicros);
+        break;
+      }
+    }
+
+    snprintf(line, sizeof(line), "  %-13s %7lu %8lu %8lu %8lu %8lu", PROFILE_NAMES[slot],
+             (unsigned long)e.count, (unsigned long)e.minMicros, (unsigned long)(e.sumMicros / e.count),
+             (unsigned long)p99, (unsigned long)e.maxMicros);
+    emit(line);
+  }
+}
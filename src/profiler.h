@@ -0,0 +1,39 @@
+#pragma once
+// ===== FRAME PROFILER =====
+// Fixed table of timing histograms, one per instrumented draw routine.
+// Recording is a few adds and a bucket increment; nothing allocates.
+// Times come from micros() (esp_timer on the ESP32).
+
+#include <Arduino.h>
+
+enum ProfileSlot : uint8_t {
+  PROF_WAITING_SCREEN,  // drawWaitingScreen()
+  PROF_TIMER_DISPLAY,   // drawTimerDisplay()
+  PROF_LOGS_SCREEN,     // drawLogsScreen() incl. reading the log file
+  PROF_COMPOSITE,       // Compositor::render()
+  PROF_LABEL_PAINT,
+  PROF_BUTTON_PAINT,    // Logs, CLEAR and TEST buttons
+  PROF_CLOCK_PAINT,
+  PROF_TIMER_PAINT,     // Whole timer readout
+  PROF_TIMER_UPDATE,    // Changed digit cells only
+  PROF_SLOTS
+};
+
+void profileRecord(ProfileSlot slot, uint32_t micros);
+void profileReset();
+
+// Emit one line per slot that has samples (count, min/avg/p99/max in us)
+void profileDump(void (*emit)(const char* line));
+
+// Times the enclosing block
+class ProfileScope {
+public:
+  explicit ProfileScope(ProfileSlot slot) : slot_(slot), start_(micros()) {}
+  ~ProfileScope() { profileRecord(slot_, micros() - start_); }
+
+private:
+  ProfileSlot slot_;
+  unsigned long start_;
+};
+
+#define PROFILE_SCOPE(slot) ProfileScope profileScope_(slot)
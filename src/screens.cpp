@@ -0,0 +1,97 @@
+#include "screens.h"
+
+// Each screen is a list of widgets; the compositor repaints only what changed
+// between the screen it last drew and the one it is asked to draw. Widgets
+// shared by the waiting and running screens stay put across the switch.
+Label titleLabel(160, 20, 3, TC_DATUM, "Nigel Timer!");
+Label touchToStartLabel(160, 100, 2, MC_DATUM, "Touch to Start");
+TimerReadout waitingTimer(WAITING_TIMER_RECT);    // Always 00:00:00, blitted direct
+TimerReadout runningTimer(TIMER_RECT, true);      // Per-cell sprite pushes
+Clock clockWidget(CLOCK_RECT, 5, 235);
+Button logsButton(LOG_BTN_RECT, "LOGS");
+
+Label logsTitleLabel(160, 10, 2, TC_DATUM, "Recent Logs");
+Label audioHealthLabel(160, 29, 1, TC_DATUM, "", { 10, 29, 300, 8 });
+Label noLogsLabel(160, 120, 2, MC_DATUM, "No logs found");
+Label* logLineLabels[LOG_LINES];
+Button clearButton({ CLEAR_BTN_X, CLEAR_BTN_Y, CLEAR_BTN_W, CLEAR_BTN_H }, "CLEAR");
+Button testButton({ TEST_BTN_X, TEST_BTN_Y, TEST_BTN_W, TEST_BTN_H }, "TEST");
+Label logsFooterLabel(160, 235, 1, BC_DATUM, "Touch anywhere to return");
+
+Screen waitingScreen(COLOR_RED);
+Screen runningScreen(COLOR_RED);
+Screen logsScreen(COLOR_BLACK);
+
+bool beginScreens(TFT_eSPI& tft) {
+  waitingTimer.begin(tft);
+  bool spriteOk = runningTimer.begin(tft);
+
+  waitingScreen.add(&titleLabel);
+  waitingScreen.add(&touchToStartLabel);
+  waitingScreen.add(&waitingTimer);
+  waitingScreen.add(&clockWidget);
+  waitingScreen.add(&logsButton);
+
+  runningScreen.add(&titleLabel);
+  runningScreen.add(&runningTimer);
+  runningScreen.add(&clockWidget);
+  runningScreen.add(&logsButton);
+
+  // Fixed-width line boxes, so a shorter line clears what a longer one left
+  for (int i = 0; i < LOG_LINES; i++) {
+    int y = 40 + i * LOG_LINE_SPACING;
+    logLineLabels[i] = new Label(10, y, 1, TL_DATUM, "", { 10, (int16_t)y, 300, 8 });
+    logLineLabels[i]->setColors(COLOR_WHITE, COLOR_BLACK);
+  }
+  logsTitleLabel.setColors(COLOR_WHITE, COLOR_BLACK);
+  noLogsLabel.setColors(COLOR_WHITE, COLOR_BLACK);
+  clearButton.setColors(COLOR_RED, COLOR_BLACK);
+  testButton.setColors(COLOR_GREEN, COLOR_BLACK);
+  logsFooterLabel.setColors(COLOR_YELLOW, COLOR_BLACK);
+
+  waitingScreen.setDefaultAction(ACTION_TIMER);
+  waitingScreen.addTarget(&logsButton, ACTION_OPEN_LOGS);
+  runningScreen.setDefaultAction(ACTION_TIMER);
+  runningScreen.addTarget(&logsButton, ACTION_OPEN_LOGS);
+  logsScreen.setDefaultAction(ACTION_CLOSE_LOGS);
+  logsScreen.addTarget(&clearButton, ACTION_CLEAR_LOGS);
+  logsScreen.addTarget(&testButton, ACTION_TEST_CHIME);
+  return spriteOk;
+}
+
+void applyTheme(uint16_t bgColor) {
+  uint16_t textColor = (bgColor == COLOR_YELLOW) ? COLOR_BLACK : COLOR_WHITE;
+  titleLabel.setColors(textColor, bgColor);
+  touchToStartLabel.setColors(textColor, bgColor);
+  waitingTimer.setColors(textColor, bgColor);
+  runningTimer.setColors(textColor, bgColor);
+  clockWidget.setColors(textColor, bgColor);
+  logsButton.setColors(textColor, bgColor);
+  waitingScreen.setBackground(bgColor);
+  runningScreen.setBackground(bgColor);
+}
+
+void setLogLines(const char* const* lines, int count) {
+  logsScreen.clear();
+  logsScreen.add(&logsTitleLabel);
+  logsScreen.add(&audioHealthLabel);
+
+  if (lines == nullptr) {
+    logsScreen.add(&noLogsLabel);
+  } else {
+    for (int i = 0; i < count && i < LOG_LINES; i++) {
+      logLineLabels[i]->setText(lines[i]);
+      logsScreen.add(logLineLabels[i]);
+    }
+  }
+
+  // Still show clear button and footer
+  logsScreen.add(&clearButton);
+  logsScreen.add(&testButton);
+  logsScreen.add(&logsFooterLabel);
+}
+
+void setAudioHealth(const char* text, bool clean) {
+  audioHealthLabel.setText(text);
+  audioHealthLabel.setColors(clean ? COLOR_GREEN : COLOR_RED, COLOR_BLACK);
+}
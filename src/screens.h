@@ -0,0 +1,81 @@
+#pragma once
+// ===== SCREENS =====
+// Layout and widgets of the waiting, running and logs screens. Kept free of
+// board code so the host build (src/native/) can render the same screens.
+
+#include "ui.h"
+
+// ===== COLOR DEFINITIONS =====
+#define COLOR_RED     0xF800
+#define COLOR_YELLOW  0xFFE0
+#define COLOR_GREEN   0x07E0
+#define COLOR_BLUE    0x001F
+#define COLOR_WHITE   0xFFFF
+#define COLOR_BLACK   0x0000
+
+// Button area for logs (lower right corner)
+const int LOG_BTN_X = 250;
+const int LOG_BTN_Y = 200;
+const int LOG_BTN_W = 70;
+const int LOG_BTN_H = 40;
+
+// Timer readout region (drawn off-screen, then pushed in one window)
+const int TIMER_X = 40;
+const int TIMER_Y = 130;
+const int TIMER_W = 240;
+const int TIMER_H = 50;
+
+// Clear button area (lower left corner on logs screen)
+const int CLEAR_BTN_X = 10;
+const int CLEAR_BTN_Y = 200;
+const int CLEAR_BTN_W = 70;
+const int CLEAR_BTN_H = 30;
+
+// Test chime button area (lower right corner on logs screen)
+const int TEST_BTN_X = 240;
+const int TEST_BTN_Y = 200;
+const int TEST_BTN_W = 70;
+const int TEST_BTN_H = 30;
+
+// ===== LAYOUT =====
+const Rect TIMER_RECT = { TIMER_X, TIMER_Y, TIMER_W, TIMER_H };
+const Rect WAITING_TIMER_RECT = { TIMER_X, 145, TIMER_W, TIMER_H };  // Centred on y=170
+const Rect CLOCK_RECT = { 0, 210, 100, 30 };
+const Rect LOG_BTN_RECT = { LOG_BTN_X, LOG_BTN_Y, LOG_BTN_W, LOG_BTN_H };
+const int LOG_LINES = 9;         // Log lines shown on the logs screen
+const int LOG_LINE_SPACING = 18;
+
+// ===== TOUCH ACTIONS =====
+// What a tap does, looked up with Screen::hitTest()
+enum TouchAction : uint8_t {
+  ACTION_NONE,
+  ACTION_TIMER,       // Start the timer, or log and reset it
+  ACTION_OPEN_LOGS,
+  ACTION_CLEAR_LOGS,
+  ACTION_TEST_CHIME,
+  ACTION_CLOSE_LOGS,  // Back to the screen before the logs
+};
+
+// ===== WIDGETS =====
+extern TimerReadout runningTimer;
+extern Clock clockWidget;
+
+extern Screen waitingScreen;
+extern Screen runningScreen;
+extern Screen logsScreen;
+
+// Allocate widget resources, fill the screens and their touch targets.
+// Returns false if the timer sprite could not be allocated.
+bool beginScreens(TFT_eSPI& tft);
+
+// Colour the waiting and running screens for a background (black text on
+// yellow for readability)
+void applyTheme(uint16_t bgColor);
+
+// Rebuild the logs screen. 'lines' are most recent first; pass nullptr
+// when there is no log file.
+void setLogLines(const char* const* lines, int count);
+
+// Audio health line under the logs title (see formatAudioHealth()), in
+// red once there has been an underrun
+void setAudioHealth(const char* text, bool clean);
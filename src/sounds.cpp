@@ -0,0 +1,47 @@
+#include "sounds.h"
+
+// Rising C major arpeggio, then the octave rung together
+static const BellNote TIME_TO_GO_NOTES[] = {
+  { 0, 1047, 200, 50 },     // C6
+  { 220, 1319, 200, 50 },   // E6
+  { 440, 1568, 200, 50 },   // G6
+  { 660, 2093, 220, 60 },   // C7
+  { 1100, 1047, 180, 80 },  // C6 + C7
+  { 1100, 2093, 140, 80 },
+};
+
+// Two soft falling notes, a mellower (harmonic) timbre
+static const BellNote WARNING_NOTES[] = {
+  { 0, 880, 150, 40 },      // A5
+  { 450, 698, 150, 50 },    // F5
+};
+
+// A short metallic tick
+static const BellNote CLICK_NOTES[] = {
+  { 0, 2400, 120, 1 },
+};
+
+static const BellSound SYNTH_SOUNDS[] = {
+  { TIME_TO_GO_NOTES, sizeof(TIME_TO_GO_NOTES) / sizeof(BellNote), 358, 48 },  // Ratio 1.4, index 3
+  { WARNING_NOTES, sizeof(WARNING_NOTES) / sizeof(BellNote), 512, 24 },        // Ratio 2, index 1.5
+  { CLICK_NOTES, sizeof(CLICK_NOTES) / sizeof(BellNote), 896, 64 },            // Ratio 3.5, index 4
+};
+
+// The tick is mostly heard over a ringing bell, so it is kept under it
+static const uint16_t SOUND_GAINS[] = { 256, 256, 160 };
+
+static const char* const SOUND_NAMES[] = {
+  "time-to-go", "warning", "reset-click",
+};
+
+const char* soundName(SoundId sound) {
+  return sound < SOUND_COUNT ? SOUND_NAMES[sound] : "?";
+}
+
+const BellSound* synthSound(SoundId sound) {
+  return sound < SOUND_COUNT ? &SYNTH_SOUNDS[sound] : nullptr;
+}
+
+uint16_t soundGain(SoundId sound) {
+  return sound < SOUND_COUNT ? SOUND_GAINS[sound] : 256;
+}
@@ -0,0 +1,23 @@
+#pragma once
+// ===== SOUNDS =====
+// The alert sounds, synthesized by BellSynth from the note data in
+// sounds.cpp. The time-to-go bell can be swapped for a sound file from
+// LittleFS (see the alert sound in main.cpp).
+
+#include "bell_synth.h"
+
+enum SoundId : uint8_t {
+  SOUND_TIME_TO_GO,    // Blue threshold
+  SOUND_WARNING,       // Yellow threshold
+  SOUND_RESET_CLICK,   // Timer reset by a tap
+  SOUND_COUNT
+};
+
+const char* soundName(SoundId sound);
+
+// Note data for a sound
+const BellSound* synthSound(SoundId sound);
+
+// Mixer gain (8.8 fixed point) for a sound, so that one layered over
+// another stays below full scale
+uint16_t soundGain(SoundId sound);
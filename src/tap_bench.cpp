@@ -0,0 +1,51 @@
+#include "tap_bench.h"
+#include <algorithm>
+
+void TapBench::start(int taps) {
+  count_ = 0;
+  target_ = constrain(taps, 1, TAP_BENCH_MAX_TAPS);
+}
+
+bool TapBench::record(const TapSample& sample) {
+  if (!active()) {
+    return false;
+  }
+  samples_[count_++] = sample;
+  return count_ >= target_;
+}
+
+// Nearest-rank percentile of a sorted array
+static uint32_t percentile(const uint32_t* sorted, int count, int pct) {
+  int rank = (pct * count + 99) / 100;
+  return sorted[max(rank, 1) - 1];
+}
+
+void TapBench::report(void (*emit)(const char* line)) {
+  static const char* const SEGMENT_NAMES[] = {
+    "irq->handler", "handler->logged", "logged->pixels", "irq->pixels",
+  };
+  char line[96];
+  uint32_t values[TAP_BENCH_MAX_TAPS];
+
+  snprintf(line, sizeof(line), "Tap latency over %d resets (us):", count_);
+  emit(line);
+  snprintf(line, sizeof(line), "  %-16s %8s %8s %8s %8s", "", "p50", "p90", "p99", "max");
+  emit(line);
+  for (int segment = 0; segment < 4; segment++) {
+    for (int i = 0; i < count_; i++) {
+      const TapSample& s = samples_[i];
+      switch (segment) {
+        case 0: values[i] = s.handlerMicros; break;
+        case 1: values[i] = s.loggedMicros - s.handlerMicros; break;
+        case 2: values[i] = s.pixelsMicros - s.loggedMicros; break;
+        default: values[i] = s.pixelsMicros; break;
+      }
+    }
+    std::sort(values, values + count_);
+    snprintf(line, sizeof(line), "  %-16s %8lu %8lu %8lu %8lu", SEGMENT_NAMES[segment],
+             (unsigned long)percentile(values, count_, 50), (unsigned long)percentile(values, count_, 90),
+             (unsigned long)percentile(values, count_, 99), (unsigned long)values[count_ - 1]);
+    emit(line);
+  }
+  target_ = 0;
+}
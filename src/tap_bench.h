@@ -0,0 +1,35 @@
+#pragma once
+// ===== TAP LATENCY BENCHMARK =====
+// Collects, for a run of timer resets, the time from the touch interrupt to
+// each stage of handling it, and reports percentiles per stage. Samples are
+// kept (not bucketed) so the report is exact; a run is at most
+// TAP_BENCH_MAX_TAPS taps.
+
+#include <Arduino.h>
+
+const int TAP_BENCH_MAX_TAPS = 50;
+
+// Stage times, in us after the touch interrupt
+struct TapSample {
+  uint32_t handlerMicros;  // handleTouchAt() entered
+  uint32_t loggedMicros;   // logEntry() returned
+  uint32_t pixelsMicros;   // drawTimerDisplay() pushed its last pixel
+};
+
+class TapBench {
+public:
+  void start(int taps);
+  bool active() const { return target_ > 0; }
+  int remaining() const { return target_ - count_; }
+
+  // Adds a sample; true when it completes the run (report, then it stops)
+  bool record(const TapSample& sample);
+
+  // One line per segment: count, p50/p90/p99/max in us
+  void report(void (*emit)(const char* line));
+
+private:
+  TapSample samples_[TAP_BENCH_MAX_TAPS];
+  int count_ = 0;
+  int target_ = 0;
+};
@@ -0,0 +1,157 @@
+#include "timer_app.h"
+#include "screens.h"
+
+TimerState currentState = WAITING_TO_START;
+TimerState stateBeforeLogs = WAITING_TO_START;  // Track state to return to after logs
+int64_t timerStartMicros = 0;
+volatile uint8_t alarmsFiredThisSession = 0;
+
+static int64_t lastTapMicros = INT64_MIN / 2;  // Far enough back that the first tap passes
+static int64_t dispatchIrqMicros = 0;          // irqMicros of the event being handled
+
+// Undo for the last reset (swipe left while running)
+static bool undoAvailable = false;
+static int64_t undoStartMicros = 0;            // Session start before the reset
+static uint8_t undoAlarmsFired = 0;
+
+void dispatchTouch(const TouchEvent& event) {
+  // Taps are debounced; a double tap follows a tap by design
+  bool isTap = event.gesture == GESTURE_TAP || event.gesture == GESTURE_LONG_PRESS;
+  int64_t now = platformMicros();
+  if (isTap && now - lastTapMicros < (int64_t)TOUCH_DEBOUNCE_MS * 1000) {
+    return;
+  }
+  if (isTap) {
+    lastTapMicros = now;
+  }
+  dispatchIrqMicros = event.irqMicros;
+  handleTouchAt(event.gesture, event.x, event.y);
+}
+
+void handleTouchAt(GestureType gesture, int touchX, int touchY) {
+  int64_t handlerMicros = platformMicros();
+  Serial.printf("Processing %s at: %d, %d\n", gestureName(gesture), touchX, touchY);
+
+  // Swipe left while running takes back the last reset
+  if (gesture == GESTURE_SWIPE_LEFT && currentState == RUNNING) {
+    undoLastReset();
+    return;
+  }
+
+  // A double tap is dropped on purpose: its first tap has already been
+  // dispatched and acted on, and acting on the second too would be the
+  // double reset the debounce is there to stop
+  if (gesture == GESTURE_DOUBLE_TAP) {
+    return;
+  }
+
+  // A long press acts as a tap (touches used to act on touch-down, however
+  // long they were held); the other swipes are not assigned yet
+  if (gesture != GESTURE_TAP && gesture != GESTURE_LONG_PRESS) {
+    return;
+  }
+
+  // One lookup in the current screen's hit-test table
+  const Screen& screen = currentState == VIEWING_LOGS ? logsScreen
+                       : currentState == RUNNING      ? runningScreen
+                                                      : waitingScreen;
+  switch (screen.hitTest(touchX, touchY)) {
+    case ACTION_CLEAR_LOGS:
+      Serial.println("Clear logs button pressed");
+      clearLogs();
+      showLogsScreen();  // Redraw to show empty logs
+      return;
+
+    case ACTION_TEST_CHIME:
+      Serial.println("Test chime button pressed");
+      playSound(SOUND_TIME_TO_GO);
+      return;  // Stay on logs screen
+
+    case ACTION_CLOSE_LOGS:
+      Serial.println("Returning from logs");
+      currentState = stateBeforeLogs;
+      if (currentState == WAITING_TO_START) {
+        showWaitingScreen();
+      } else {
+        startTicks();
+      }
+      return;
+
+    case ACTION_OPEN_LOGS:
+      Serial.println("Logs button pressed");
+      stateBeforeLogs = currentState;  // Remember where we came from
+      currentState = VIEWING_LOGS;
+      stopTicks();
+      showLogsScreen();
+      return;
+
+    case ACTION_TIMER:
+      break;  // Below
+
+    default:
+      return;
+  }
+
+  if (currentState == WAITING_TO_START) {
+    // First touch (not on logs button) - start the timer
+    Serial.println("Timer started!");
+    currentState = RUNNING;
+    undoAvailable = false;
+    scheduleAlarms(platformMicros(), 0);
+
+    // Draw initial running display and schedule the next second
+    startTicks();
+
+  } else if (currentState == RUNNING) {
+    // Subsequent touch (not on logs button) - log duration and reset
+    unsigned long elapsedSeconds = getElapsedSeconds();
+    int hours, minutes, seconds;
+    formatTime(elapsedSeconds, hours, minutes, seconds);
+
+    // Log the duration
+    char logMessage[64];
+    snprintf(logMessage, sizeof(logMessage), "-- Duration: %02d:%02d:%02d", hours, minutes, seconds);
+    logEntry(logMessage);
+    playSound(SOUND_RESET_CLICK);
+
+    onResetLogged(dispatchIrqMicros, handlerMicros);
+
+    Serial.print("Timer reset! Previous duration: ");
+    Serial.println(logMessage);
+
+    // Reset timer, keeping the old session for undo
+    undoAvailable = true;
+    undoStartMicros = timerStartMicros;
+    undoAlarmsFired = scheduleAlarms(platformMicros(), 0);
+
+    // Redraw with red background
+    startTicks();
+  }
+}
+
+void undoLastReset() {
+  if (!undoAvailable) {
+    Serial.println("Nothing to undo");
+    return;
+  }
+  undoAvailable = false;
+  scheduleAlarms(undoStartMicros, undoAlarmsFired);
+
+  // The log is append-only; record the undo next to the entry it cancels
+  logEntry("-- Undo last reset");
+  Serial.println("Last reset undone");
+  startTicks();
+}
+
+unsigned long getElapsedSeconds() {
+  if (currentState != RUNNING) {
+    return 0;
+  }
+  return (platformMicros() - timerStartMicros) / 1000000;
+}
+
+void formatTime(unsigned long totalSeconds, int &hours, int &minutes, int &secs) {
+  hours = totalSeconds / 3600;
+  minutes = (totalSeconds % 3600) / 60;
+  secs = totalSeconds % 60;
+}
@@ -0,0 +1,46 @@
+#pragma once
+// ===== TIMER STATE MACHINE =====
+// What touches do: start and reset the timer (logging each duration), undo
+// a reset, and open, clear and close the logs. Kept free of board code so
+// recorded touches can be replayed on the host (src/native/replay_touch.cpp).
+// Its effects go through the platform functions at the end, which main.cpp
+// implements on the board.
+
+#include <Arduino.h>
+#include "gesture.h"
+#include "sounds.h"
+
+enum TimerState {
+  WAITING_TO_START,
+  RUNNING,
+  VIEWING_LOGS
+};
+
+const unsigned long TOUCH_DEBOUNCE_MS = 500;  // Minimum time between two taps
+
+extern TimerState currentState;
+// Set through scheduleAlarms() only, which the alarm callback shares a lock with
+extern int64_t timerStartMicros;      // platformMicros() when the current session started
+extern volatile uint8_t alarmsFiredThisSession;  // Of the session's AlarmSchedule
+
+// Debounce a gesture from the touch path and act on it
+void dispatchTouch(const TouchEvent& event);
+void handleTouchAt(GestureType gesture, int touchX, int touchY);
+void undoLastReset();
+unsigned long getElapsedSeconds();
+void formatTime(unsigned long seconds, int &hours, int &minutes, int &secs);
+
+// ===== PLATFORM =====
+int64_t platformMicros();             // Monotonic time (esp_timer on the board)
+void logEntry(const char* message);   // Append a timestamped line to the log
+void clearLogs();
+void playSound(SoundId sound);        // Start a sound, layered over any playing
+// The session started or changed: set it and arm its next alarm. Returns
+// how many alarms of the session it replaced had fired.
+uint8_t scheduleAlarms(int64_t startMicros, uint8_t fired);
+void startTicks();                    // Show the running timer from now on
+void stopTicks();
+void showWaitingScreen();
+void showLogsScreen();                // Also after the log changed
+// A reset was logged; times are platformMicros() values
+void onResetLogged(int64_t irqMicros, int64_t handlerMicros);
@@ -0,0 +1,78 @@
+#include "touch_cal.h"
+
+void TouchCalibration::apply(int rawX, int rawY, int &screenX, int &screenY) const {
+  screenX = lroundf(a * rawX + b * rawY + c);
+  screenY = lroundf(d * rawX + e * rawY + f);
+}
+
+TouchCalibration TouchCalibration::fromRange(int minX, int maxX, int minY, int maxY, int width, int height) {
+  float sx = (float)width / (maxX - minX);
+  float sy = (float)height / (maxY - minY);
+  return { sx, 0, -minX * sx, 0, sy, -minY * sy };
+}
+
+bool TouchCalibration::solve(const int raw[3][2], const int screen[3][2], TouchCalibration &out) {
+  // Cramer's rule on the raw points relative to the third one
+  float x0 = raw[0][0] - raw[2][0], y0 = raw[0][1] - raw[2][1];
+  float x1 = raw[1][0] - raw[2][0], y1 = raw[1][1] - raw[2][1];
+  float det = x0 * y1 - x1 * y0;
+  if (fabsf(det) < 1000.0f) {
+    return false;
+  }
+
+  float u0 = screen[0][0] - screen[2][0], u1 = screen[1][0] - screen[2][0];
+  float v0 = screen[0][1] - screen[2][1], v1 = screen[1][1] - screen[2][1];
+  out.a = (u0 * y1 - u1 * y0) / det;
+  out.b = (x0 * u1 - x1 * u0) / det;
+  out.c = screen[2][0] - out.a * raw[2][0] - out.b * raw[2][1];
+  out.d = (v0 * y1 - v1 * y0) / det;
+  out.e = (x0 * v1 - x1 * v0) / det;
+  out.f = screen[2][1] - out.d * raw[2][0] - out.e * raw[2][1];
+  return true;
+}
+
+// Insertion sort is plenty for a 5-sample burst
+static int median(int16_t* values, int count) {
+  for (int i = 1; i < count; i++) {
+    int16_t v = values[i];
+    int j = i - 1;
+    while (j >= 0 && values[j] > v) {
+      values[j + 1] = values[j];
+      j--;
+    }
+    values[j + 1] = v;
+  }
+  return values[count / 2];
+}
+
+bool TouchFilter::filter(const int16_t xs[], const int16_t ys[], const int16_t zs[], int count, int zMin,
+                         int &rawX, int &rawY, int &rawZ) {
+  int16_t vx[TOUCH_BURST_SAMPLES], vy[TOUCH_BURST_SAMPLES], vz[TOUCH_BURST_SAMPLES];
+  int valid = 0;
+  for (int i = 0; i < count && valid < TOUCH_BURST_SAMPLES; i++) {
+    if (zs[i] >= zMin) {
+      vx[valid] = xs[i];
+      vy[valid] = ys[i];
+      vz[valid] = zs[i];
+      valid++;
+    }
+  }
+  if (valid < TOUCH_BURST_MIN_VALID) {
+    return false;
+  }
+
+  rawZ = median(vz, valid);
+  int mx = median(vx, valid) << TOUCH_IIR_SHIFT;
+  int my = median(vy, valid) << TOUCH_IIR_SHIFT;
+  if (!primed_) {
+    x_ = mx;
+    y_ = my;
+    primed_ = true;
+  } else {
+    x_ += (mx - x_) >> TOUCH_IIR_SHIFT;
+    y_ += (my - y_) >> TOUCH_IIR_SHIFT;
+  }
+  rawX = x_ >> TOUCH_IIR_SHIFT;
+  rawY = y_ >> TOUCH_IIR_SHIFT;
+  return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+// ===== RESISTIVE TOUCH FILTERING AND CALIBRATION =====
+// Turns noisy XPT2046 readings into screen coordinates: each read is the
+// median of a burst of samples that passed the pressure threshold, smoothed
+// across reads of the same stroke, then mapped through an affine matrix
+// fitted to three touched targets.
+
+#include <Arduino.h>
+
+const int TOUCH_BURST_SAMPLES = 5;       // Samples per read (median)
+const int TOUCH_BURST_MIN_VALID = 3;     // Fewer above the z threshold is no touch
+const int TOUCH_IIR_SHIFT = 1;           // Each read moves the output 1/2 of the way
+
+// screenX = a*rawX + b*rawY + c, screenY = d*rawX + e*rawY + f
+struct TouchCalibration {
+  float a, b, c;
+  float d, e, f;
+
+  void apply(int rawX, int rawY, int &screenX, int &screenY) const;
+
+  // Linear map of [minX,maxX] x [minY,maxY] onto the screen (no skew)
+  static TouchCalibration fromRange(int minX, int maxX, int minY, int maxY, int width, int height);
+
+  // Fit the matrix that takes the three raw points onto the three screen
+  // points. False if the raw points are (nearly) collinear.
+  static bool solve(const int raw[3][2], const int screen[3][2], TouchCalibration &out);
+};
+
+class TouchFilter {
+public:
+  // Start of a stroke: the next read is taken as is
+  void reset() { primed_ = false; }
+
+  // Median of the burst (entries with z below zMin are ignored), smoothed
+  // with the previous reads of the stroke; rawZ is the median pressure,
+  // unsmoothed. False if too few samples passed.
+  bool filter(const int16_t xs[], const int16_t ys[], const int16_t zs[], int count, int zMin,
+              int &rawX, int &rawY, int &rawZ);
+
+private:
+  bool primed_ = false;
+  int x_ = 0, y_ = 0;  // Smoothed, scaled by 1 << TOUCH_IIR_SHIFT
+};
@@ -0,0 +1,35 @@
+#include "touch_trace.h"
+
+int formatTouchSample(const TouchSample& sample, char* line, size_t size) {
+  int len = snprintf(line, size, "%lu %d %d %u %u", (unsigned long)sample.ms, sample.x, sample.y,
+                     sample.pressure, sample.hint);
+  return (len > 0 && (size_t)len < size) ? len : 0;
+}
+
+bool parseTouchSample(const char* line, TouchSample& sample) {
+  unsigned long ms;
+  int x, y;
+  unsigned pressure, hint;
+  if (line[0] == '#' || sscanf(line, "%lu %d %d %u %u", &ms, &x, &y, &pressure, &hint) != 5) {
+    return false;
+  }
+  if (hint > GESTURE_SWIPE_ANY) {
+    return false;
+  }
+  sample = { (uint32_t)ms, (int16_t)x, (int16_t)y, (uint16_t)pressure, (GestureType)hint };
+  return true;
+}
+
+void TouchPipeline::feed(const TouchSample& sample, int64_t micros) {
+  bool touched = sample.pressure > 0;
+  if (touched && !down_) {
+    strokeMicros_ = micros;
+  }
+  down_ = touched;
+
+  GestureType gesture = classifier_.update(touched, sample.x, sample.y, sample.ms, sample.hint);
+  if (gesture != GESTURE_NONE) {
+    TouchEvent event = { gesture, (int16_t)classifier_.startX(), (int16_t)classifier_.startY(), strokeMicros_ };
+    emit_(event);
+  }
+}
@@ -0,0 +1,41 @@
+#pragma once
+// ===== TOUCH TRACES =====
+// A trace is the touch path's input, one sample per controller read, as
+// text lines "ms x y pressure hint" ('#' starts a comment). The board
+// records traces to LittleFS and replays them through the same
+// TouchPipeline that live reads go through; the host replays them against
+// the timer state machine (src/native/replay_touch.cpp).
+
+#include <Arduino.h>
+#include "gesture.h"
+
+#define TOUCH_TRACE_PATH "/touch.trc"
+#define TOUCH_TRACE_HEADER "# touch trace: ms x y pressure hint"
+
+struct TouchSample {
+  uint32_t ms;        // Time of the read (millis() when recorded)
+  int16_t x, y;       // Screen coordinates; a release repeats the last position
+  uint16_t pressure;  // XPT2046 z or CST816S finger count; 0 = released
+  GestureType hint;   // Controller's own gesture verdict
+};
+
+// Returns the line length (no newline), or 0 if it did not fit
+int formatTouchSample(const TouchSample& sample, char* line, size_t size);
+// False for comments, blank and malformed lines
+bool parseTouchSample(const char* line, TouchSample& sample);
+
+// Samples in, gesture events out. A stroke's events carry the time of the
+// stroke's first sample (the interrupt time on the board).
+class TouchPipeline {
+public:
+  explicit TouchPipeline(void (*emit)(const TouchEvent& event)) : emit_(emit) {}
+
+  // 'micros' is the platform time of the sample
+  void feed(const TouchSample& sample, int64_t micros);
+
+private:
+  void (*emit_)(const TouchEvent& event);
+  GestureClassifier classifier_;
+  bool down_ = false;
+  int64_t strokeMicros_ = 0;
+};
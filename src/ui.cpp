@@ -0,0 +1,769 @@
+#include "ui.h"
+#include "profiler.h"
+#include <assert.h>
+#include <esp_heap_caps.h>
+
+// Pre-rendered RLE digit glyphs in PROGMEM (generated by tools/gen_digit_atlas.py)
+#include "digit-atlas.h"
+
+const AtlasFont& TIMER_FONT = timerAtlas;
+const AtlasFont& CLOCK_FONT = clockAtlas;
+
+// ===== RECT =====
+
+bool Rect::intersects(const Rect& o) const {
+  return !isEmpty() && !o.isEmpty() &&
+         x < o.x + o.w && o.x < x + w && y < o.y + o.h && o.y < y + h;
+}
+
+Rect Rect::intersect(const Rect& o) const {
+  int left = max(x, o.x);
+  int top = max(y, o.y);
+  int right = min(x + w, o.x + o.w);
+  int bottom = min(y + h, o.y + o.h);
+  if (right <= left || bottom <= top) {
+    return { 0, 0, 0, 0 };
+  }
+  return { (int16_t)left, (int16_t)top, (int16_t)(right - left), (int16_t)(bottom - top) };
+}
+
+Rect Rect::unite(const Rect& o) const {
+  if (isEmpty()) return o;
+  if (o.isEmpty()) return *this;
+  int left = min(x, o.x);
+  int top = min(y, o.y);
+  int right = max(x + w, o.x + o.w);
+  int bottom = max(y + h, o.y + o.h);
+  return { (int16_t)left, (int16_t)top, (int16_t)(right - left), (int16_t)(bottom - top) };
+}
+
+// ===== LAYOUT HELPERS =====
+
+// Split the area into horizontal bands at every hole edge, then fill the
+// gaps between the holes crossing each band
+uint32_t fillSpans(TFT_eSPI& tft, const Rect& area, const Rect* holes, int holeCount, uint16_t color) {
+  holeCount = min(holeCount, MAX_LAYOUT_HOLES);
+  int edges[2 * MAX_LAYOUT_HOLES + 2];
+  int edgeCount = 0;
+  edges[edgeCount++] = area.y;
+  edges[edgeCount++] = area.y + area.h;
+  for (int i = 0; i < holeCount; i++) {
+    edges[edgeCount++] = constrain(holes[i].y, area.y, area.y + area.h);
+    edges[edgeCount++] = constrain(holes[i].y + holes[i].h, area.y, area.y + area.h);
+  }
+  std::sort(edges, edges + edgeCount);
+
+  uint32_t filled = 0;
+  for (int e = 0; e + 1 < edgeCount; e++) {
+    int y0 = edges[e];
+    int y1 = edges[e + 1];
+    if (y1 <= y0) {
+      continue;
+    }
+
+    // Holes crossing this band, sorted by x
+    const Rect* band[MAX_LAYOUT_HOLES];
+    int bandCount = 0;
+    for (int i = 0; i < holeCount; i++) {
+      if (!holes[i].isEmpty() && holes[i].y < y1 && holes[i].y + holes[i].h > y0) {
+        band[bandCount++] = &holes[i];
+      }
+    }
+    std::sort(band, band + bandCount, [](const Rect* a, const Rect* b) { return a->x < b->x; });
+
+    int x = area.x;
+    for (int i = 0; i <= bandCount; i++) {
+      int gapEnd = (i < bandCount) ? max((int)band[i]->x, (int)area.x) : area.x + area.w;
+      gapEnd = min(gapEnd, area.x + area.w);
+      if (gapEnd > x) {
+        tft.fillRect(x, y0, gapEnd - x, y1 - y0, color);
+        filled += (gapEnd - x) * (y1 - y0);
+      }
+      if (i < bandCount) {
+        x = max(x, band[i]->x + (int)band[i]->w);
+      }
+    }
+  }
+  return filled;
+}
+
+// GLCD cells are 6x8 pixels scaled by the text size; datums 0-8 are
+// TL, TC, TR, ML, MC, MR, BL, BC, BR
+Rect glcdTextRect(const char* str, uint8_t size, uint8_t datum, int x, int y) {
+  int w = strlen(str) * 6 * size;
+  int h = 8 * size;
+  int left = x - ((datum % 3 == 1) ? w / 2 : (datum % 3 == 2) ? w : 0);
+  int top = y - ((datum / 3 == 1) ? h / 2 : (datum / 3 == 2) ? h : 0);
+  return { (int16_t)left, (int16_t)top, (int16_t)w, (int16_t)h };
+}
+
+// GLCD text with a background colour writes every pixel of its box once
+static void drawOpaqueText(TFT_eSPI& tft, const char* str, uint8_t size, uint8_t datum, int x, int y,
+                           uint16_t fg, uint16_t bg) {
+  tft.setTextColor(fg, bg);
+  tft.setTextDatum(datum);
+  tft.setTextSize(size);
+  tft.drawString(str, x, y);
+}
+
+// FNV-1a, for widget signatures
+static uint32_t hashBytes(uint32_t h, const void* data, size_t len) {
+  const uint8_t* p = (const uint8_t*)data;
+  while (len--) {
+    h = (h ^ *p++) * 16777619u;
+  }
+  return h;
+}
+
+static uint32_t hashStart(const void* self, const Rect& box, uint16_t fg, uint16_t bg) {
+  uint32_t h = hashBytes(2166136261u, &self, sizeof(self));
+  h = hashBytes(h, &box, sizeof(box));
+  h = hashBytes(h, &fg, sizeof(fg));
+  return hashBytes(h, &bg, sizeof(bg));
+}
+
+// ===== GLYPH ATLAS =====
+// Glyphs are runs of 4 coverage levels (see tools/gen_digit_atlas.py). Each
+// run maps to one blended colour, so a glyph streams into the SPI window as a
+// few dozen pushBlock() calls instead of per-pixel scaled rectangles.
+
+static const AtlasGlyph* findGlyph(const AtlasFont& font, char ch) {
+  for (int i = 0; i < font.count; i++) {
+    if (font.glyphs[i].ch == ch) {
+      return &font.glyphs[i];
+    }
+  }
+  return nullptr;
+}
+
+bool atlasCovers(const AtlasFont& font, const char* str) {
+  for (; *str; str++) {
+    if (findGlyph(font, *str) == nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int atlasTextWidth(const AtlasFont& font, const char* str) {
+  int width = 0;
+  for (; *str; str++) {
+    const AtlasGlyph* glyph = findGlyph(font, *str);
+    if (glyph != nullptr) {
+      width += glyph->w + font.spacing;
+    }
+  }
+  return width > 0 ? width - font.spacing : 0;
+}
+
+int atlasHeight(const AtlasFont& font) {
+  return font.height;
+}
+
+// Blend the 4 coverage levels once per glyph
+static void atlasShades(TFT_eSPI& tft, uint16_t fg, uint16_t bg, uint16_t shades[4]) {
+  shades[0] = bg;
+  shades[1] = tft.alphaBlend(85, fg, bg);
+  shades[2] = tft.alphaBlend(170, fg, bg);
+  shades[3] = fg;
+}
+
+// Decode straight into a panel address window covering the visible part
+// of the glyph. Address windows ignore the viewport, so clip here.
+static void blitGlyph(TFT_eSPI& tft, const AtlasFont& font, const AtlasGlyph* glyph, int x, int y,
+                      uint16_t fg, uint16_t bg, const Rect& clip) {
+  Rect box = { (int16_t)x, (int16_t)y, glyph->w, font.height };
+  Rect vis = box.intersect(clip);
+  if (vis.isEmpty()) {
+    return;
+  }
+
+  uint16_t shades[4];
+  atlasShades(tft, fg, bg, shades);
+
+  const uint8_t* rle = font.data + glyph->offset;
+  tft.startWrite();
+  tft.setAddrWindow(vis.x, vis.y, vis.w, vis.h);
+  if (vis == box) {
+    for (int i = 0; i < glyph->size; i++) {
+      uint8_t run = pgm_read_byte(rle + i);
+      tft.pushBlock(shades[run >> 6], (run & 0x3F) + 1);
+    }
+  } else {
+    // Walk the runs row by row, pushing only the visible columns
+    int colStart = vis.x - x, colEnd = colStart + vis.w;
+    int rowStart = vis.y - y, rowEnd = rowStart + vis.h;
+    int col = 0, row = 0;
+    for (int i = 0; i < glyph->size && row < rowEnd; i++) {
+      uint8_t run = pgm_read_byte(rle + i);
+      int len = (run & 0x3F) + 1;
+      while (len > 0) {
+        int seg = min(len, glyph->w - col);
+        if (row >= rowStart) {
+          int from = max(col, colStart), to = min(col + seg, colEnd);
+          if (to > from) {
+            tft.pushBlock(shades[run >> 6], to - from);
+          }
+        }
+        col += seg;
+        len -= seg;
+        if (col == glyph->w) {
+          col = 0;
+          row++;
+        }
+      }
+    }
+  }
+  tft.endWrite();
+}
+
+// Blit a string left to right, filling the gaps between glyphs so every
+// pixel of the text box is written exactly once
+static void drawAtlasString(TFT_eSPI& tft, const AtlasFont& font, const char* str, int x, int y,
+                            uint16_t fg, uint16_t bg, const Rect& clip) {
+  int startX = x;
+  for (; *str; str++) {
+    const AtlasGlyph* glyph = findGlyph(font, *str);
+    if (glyph == nullptr) {
+      continue;
+    }
+    if (x != startX) {
+      Rect gap = Rect{ (int16_t)x, (int16_t)y, font.spacing, font.height }.intersect(clip);
+      if (!gap.isEmpty()) {
+        tft.fillRect(gap.x, gap.y, gap.w, gap.h, bg);
+      }
+      x += font.spacing;
+    }
+    blitGlyph(tft, font, glyph, x, y, fg, bg, clip);
+    x += glyph->w;
+  }
+}
+
+// Decode into a 16-bit sprite buffer (sprites hold byte-swapped RGB565)
+static void decodeGlyph(TFT_eSPI& tft, const AtlasFont& font, const AtlasGlyph* glyph, uint16_t* dst, int stride,
+                        uint16_t fg, uint16_t bg) {
+  uint16_t shades[4];
+  atlasShades(tft, fg, bg, shades);
+  for (int i = 0; i < 4; i++) {
+    shades[i] = (shades[i] >> 8) | (shades[i] << 8);
+  }
+
+  const uint8_t* rle = font.data + glyph->offset;
+  int col = 0;
+  for (int i = 0; i < glyph->size; i++) {
+    uint8_t run = pgm_read_byte(rle + i);
+    uint16_t color = shades[run >> 6];
+    for (int n = (run & 0x3F) + 1; n > 0; n--) {
+      dst[col] = color;
+      if (++col == glyph->w) {
+        col = 0;
+        dst += stride;
+      }
+    }
+  }
+}
+
+// ===== DISPLAY DMA =====
+
+static bool dmaReady = false;     // initDMA() succeeded
+static bool dmaInFlight = false;  // startWrite() held open for a DMA transfer
+
+bool initDisplayDMA(TFT_eSPI& tft) {
+  dmaReady = tft.initDMA();
+  return dmaReady;
+}
+
+// Let queued transfers finish (the caller blocks, it does not spin) and
+// release the bus so blocking draws can follow
+void finishDisplayFrame(TFT_eSPI& tft) {
+  if (dmaInFlight) {
+    tft.dmaWait();
+    tft.endWrite();
+    dmaInFlight = false;
+  }
+}
+
+// ===== LABEL =====
+
+Label::Label(int x, int y, uint8_t size, uint8_t datum, const char* text, Rect box)
+    : x_(x), y_(y), size_(size), datum_(datum), box_(box) {
+  setText(text);
+}
+
+void Label::setText(const char* text) {
+  strncpy(text_, text, sizeof(text_) - 1);
+  text_[sizeof(text_) - 1] = '\0';
+}
+
+void Label::setColors(uint16_t fg, uint16_t bg) {
+  fg_ = fg;
+  bg_ = bg;
+}
+
+Rect Label::bounds() const {
+  return box_.isEmpty() ? glcdTextRect(text_, size_, datum_, x_, y_) : box_;
+}
+
+uint32_t Label::signature() const {
+  uint32_t h = hashStart(this, bounds(), fg_, bg_);
+  return hashBytes(h, text_, strlen(text_));
+}
+
+uint32_t Label::paint(TFT_eSPI& tft, const Rect& clip) {
+  PROFILE_SCOPE(PROF_LABEL_PAINT);
+  Rect box = bounds();
+  Rect vis = box.intersect(clip);
+  if (vis.isEmpty()) {
+    return 0;
+  }
+
+  tft.setViewport(vis.x, vis.y, vis.w, vis.h, false);
+  Rect text = glcdTextRect(text_, size_, datum_, x_, y_).intersect(box);
+  fillSpans(tft, box, &text, text.isEmpty() ? 0 : 1, bg_);
+  if (text_[0] != '\0') {
+    drawOpaqueText(tft, text_, size_, datum_, x_, y_, fg_, bg_);
+  }
+  tft.resetViewport();
+  return vis.area();
+}
+
+// ===== BUTTON =====
+
+Button::Button(Rect box, const char* label, uint8_t textSize)
+    : box_(box), label_(label), textSize_(textSize) {}
+
+void Button::setColors(uint16_t fg, uint16_t bg) {
+  fg_ = fg;
+  bg_ = bg;
+}
+
+uint32_t Button::signature() const {
+  uint32_t h = hashStart(this, box_, fg_, bg_);
+  return hashBytes(h, label_, strlen(label_));
+}
+
+// Frame, interior around the label, then the label, each pixel once
+uint32_t Button::paint(TFT_eSPI& tft, const Rect& clip) {
+  PROFILE_SCOPE(PROF_BUTTON_PAINT);
+  Rect vis = box_.intersect(clip);
+  if (vis.isEmpty()) {
+    return 0;
+  }
+
+  int cx = box_.x + box_.w / 2;
+  int cy = box_.y + box_.h / 2;
+  tft.setViewport(vis.x, vis.y, vis.w, vis.h, false);
+  tft.drawRect(box_.x, box_.y, box_.w, box_.h, fg_);
+  Rect interior = { (int16_t)(box_.x + 1), (int16_t)(box_.y + 1), (int16_t)(box_.w - 2), (int16_t)(box_.h - 2) };
+  Rect text = glcdTextRect(label_, textSize_, MC_DATUM, cx, cy);
+  fillSpans(tft, interior, &text, 1, bg_);
+  drawOpaqueText(tft, label_, textSize_, MC_DATUM, cx, cy, fg_, bg_);
+  tft.resetViewport();
+  return vis.area();
+}
+
+// ===== CLOCK =====
+
+Clock::Clock(Rect box, int x, int baseline) : box_(box), x_(x), baseline_(baseline) {
+  text_[0] = '\0';
+}
+
+bool Clock::setText(const char* text) {
+  if (strncmp(text_, text, sizeof(text_) - 1) == 0) {
+    return false;
+  }
+  strncpy(text_, text, sizeof(text_) - 1);
+  text_[sizeof(text_) - 1] = '\0';
+  return true;
+}
+
+void Clock::setColors(uint16_t fg, uint16_t bg) {
+  fg_ = fg;
+  bg_ = bg;
+}
+
+uint32_t Clock::signature() const {
+  uint32_t h = hashStart(this, box_, fg_, bg_);
+  return hashBytes(h, text_, strlen(text_));
+}
+
+// Fill the box around the text, then draw the text opaquely
+uint32_t Clock::paint(TFT_eSPI& tft, const Rect& clip) {
+  PROFILE_SCOPE(PROF_CLOCK_PAINT);
+  Rect vis = box_.intersect(clip);
+  if (vis.isEmpty()) {
+    return 0;
+  }
+
+  tft.setViewport(vis.x, vis.y, vis.w, vis.h, false);
+  if (atlasCovers(CLOCK_FONT, text_)) {
+    Rect text = Rect{ x_, (int16_t)(baseline_ - CLOCK_FONT.height),
+                      (int16_t)atlasTextWidth(CLOCK_FONT, text_), CLOCK_FONT.height }.intersect(box_);
+    fillSpans(tft, box_, &text, text.isEmpty() ? 0 : 1, bg_);
+    drawAtlasString(tft, CLOCK_FONT, text_, x_, baseline_ - CLOCK_FONT.height, fg_, bg_, vis);
+  } else {
+    // "No WiFi" / "No Time" are not in the atlas
+    Rect text = glcdTextRect(text_, 2, BL_DATUM, x_, baseline_).intersect(box_);
+    fillSpans(tft, box_, &text, text.isEmpty() ? 0 : 1, bg_);
+    drawOpaqueText(tft, text_, 2, BL_DATUM, x_, baseline_, fg_, bg_);
+  }
+  tft.resetViewport();
+  return vis.area();
+}
+
+// ===== TIMER READOUT =====
+
+TimerReadout::TimerReadout(Rect box, bool useSprite) : box_(box), useSprite_(useSprite) {
+  strcpy(text_, "00:00:00");
+  memset(spriteCells_, 0, CELLS);
+  memset(drawnCells_, 0, CELLS);
+}
+
+bool TimerReadout::begin(TFT_eSPI& tft) {
+  layoutCells();
+  if (!useSprite_) {
+    return true;
+  }
+
+  // Sprite covers the whole box (240x50x16bpp = 24 KB)
+  sprite_ = new TFT_eSprite(&tft);
+  sprite_->setColorDepth(16);
+  if (sprite_->createSprite(box_.w, box_.h) == nullptr) {
+    delete sprite_;
+    sprite_ = nullptr;
+    return false;
+  }
+
+  // DMA-capable staging for partial cell pushes (sub-rectangles of the
+  // sprite are not contiguous)
+  dmaStage_ = (uint16_t*)heap_caps_malloc(box_.w * TIMER_FONT.height * sizeof(uint16_t), MALLOC_CAP_DMA);
+  return true;
+}
+
+// Cell edges for "hh:mm:ss", centred in the box. Each cell owns the spacing
+// after its glyph, so cells tile the readout without gaps.
+void TimerReadout::layoutCells() {
+  const char* pattern = "00:00:00";
+  int x = (box_.w - atlasTextWidth(TIMER_FONT, pattern)) / 2;
+  for (int i = 0; i < CELLS; i++) {
+    cellX_[i] = x;
+    x += findGlyph(TIMER_FONT, pattern[i])->w + TIMER_FONT.spacing;
+  }
+  cellX_[CELLS] = x;
+  textY_ = (box_.h - TIMER_FONT.height) / 2;
+}
+
+void TimerReadout::setSeconds(unsigned long seconds) {
+  // Eight cells: the readout holds at 99:59:59
+  const unsigned long MAX_SECONDS = 99 * 3600UL + 59 * 60 + 59;
+  if (seconds > MAX_SECONDS) {
+    seconds = MAX_SECONDS;
+  }
+  char text[sizeof(text_)];
+  int len = snprintf(text, sizeof(text), "%02u:%02u:%02u", (unsigned)(seconds / 3600),
+                     (unsigned)(seconds % 3600 / 60), (unsigned)(seconds % 60));
+  assert(len == CELLS);  // The cell layout, signature and update() rely on it
+  (void)len;
+  if (strcmp(text, text_) != 0) {
+    strcpy(text_, text);
+    stats_.ticks++;
+  }
+}
+
+void TimerReadout::setColors(uint16_t fg, uint16_t bg) {
+  if (fg != fg_ || bg != bg_) {
+    fg_ = fg;
+    bg_ = bg;
+    spriteStale_ = true;  // Colours are baked into the sprite
+  }
+}
+
+TimerReadout::Stats TimerReadout::takeStats() {
+  Stats s = stats_;
+  uint32_t lastPixels = stats_.lastPixels;
+  stats_ = {};
+  stats_.lastPixels = lastPixels;
+  return s;
+}
+
+// Without a sprite there are no cells to diff, so the text is in the
+// signature and every change repaints; with one, digit changes go through
+// update()
+uint32_t TimerReadout::signature() const {
+  uint32_t h = hashStart(this, box_, fg_, bg_);
+  if (sprite_ == nullptr) {
+    h = hashBytes(h, text_, CELLS);
+  }
+  return h;
+}
+
+// Bring the sprite in line with text_: re-decode only cells whose glyph
+// differs from what the sprite already holds
+void TimerReadout::decodeText(int fromCell, int toCell) {
+  uint16_t* pixels = (uint16_t*)sprite_->getPointer();
+  unsigned long t0 = micros();
+
+  if (spriteStale_) {
+    sprite_->fillSprite(bg_);  // Clear margins and spacing too
+    memset(spriteCells_, 0, CELLS);
+    spriteStale_ = false;
+    fromCell = 0;
+    toCell = CELLS;
+  }
+  for (int i = fromCell; i < toCell; i++) {
+    if (spriteCells_[i] == text_[i]) {
+      continue;
+    }
+    const AtlasGlyph* glyph = findGlyph(TIMER_FONT, text_[i]);
+    if (glyph != nullptr) {
+      decodeGlyph(*sprite_, TIMER_FONT, glyph, pixels + textY_ * box_.w + cellX_[i], box_.w, fg_, bg_);
+      stats_.glyphs++;
+    }
+    spriteCells_[i] = text_[i];
+  }
+  stats_.decodeMicros += micros() - t0;
+}
+
+uint32_t TimerReadout::paint(TFT_eSPI& tft, const Rect& clip) {
+  PROFILE_SCOPE(PROF_TIMER_PAINT);
+  Rect vis = box_.intersect(clip);
+  if (vis.isEmpty()) {
+    return 0;
+  }
+
+  if (sprite_ == nullptr) {
+    // No sprite: fill around the text and blit straight to the panel
+    unsigned long t0 = micros();
+    int width = atlasTextWidth(TIMER_FONT, text_);
+    Rect text = { (int16_t)(box_.x + (box_.w - width) / 2), (int16_t)(box_.y + textY_),
+                  (int16_t)width, TIMER_FONT.height };
+    tft.setViewport(vis.x, vis.y, vis.w, vis.h, false);
+    fillSpans(tft, box_, &text, 1, bg_);
+    drawAtlasString(tft, TIMER_FONT, text_, text.x, text.y, fg_, bg_, vis);
+    tft.resetViewport();
+    stats_.glyphs += CELLS;
+    stats_.decodeMicros += micros() - t0;
+    stats_.lastPixels = vis.area();
+    return vis.area();
+  }
+
+  decodeText(0, CELLS);
+  if (vis == box_) {
+    pushRegion(tft, 0, 0, box_.w, box_.h);
+  } else {
+    // Partial repaint (another widget's damage overlaps us): rare, push it
+    // blocking so the DMA staging slots stay free for cell runs
+    finishDisplayFrame(tft);
+    sprite_->pushSprite(vis.x, vis.y, vis.x - box_.x, vis.y - box_.y, vis.w, vis.h);
+  }
+
+  // Cells fully inside the pushed area are now current on the panel
+  for (int i = 0; i < CELLS; i++) {
+    bool covered = box_.x + cellX_[i] >= vis.x && box_.x + cellX_[i + 1] <= vis.x + vis.w &&
+                   box_.y + textY_ >= vis.y && box_.y + textY_ + TIMER_FONT.height <= vis.y + vis.h;
+    if (covered) {
+      drawnCells_[i] = text_[i];
+    }
+  }
+  stats_.lastPixels = vis.area();
+  return vis.area();
+}
+
+// Push each run of adjacent changed cells as one window
+uint32_t TimerReadout::update(TFT_eSPI& tft) {
+  if (sprite_ == nullptr || memcmp(text_, drawnCells_, CELLS) == 0) {
+    return 0;  // Nothing changed, or text changes are in the signature (paint())
+  }
+  PROFILE_SCOPE(PROF_TIMER_UPDATE);
+
+  uint32_t pixels = 0;
+  int i = 0;
+  while (i < CELLS) {
+    if (text_[i] == drawnCells_[i]) {
+      i++;
+      continue;
+    }
+    int runStart = i;
+    while (i < CELLS && text_[i] != drawnCells_[i]) {
+      drawnCells_[i] = text_[i];
+      i++;
+    }
+    decodeText(runStart, i);
+
+    int sx = cellX_[runStart];
+    int w = cellX_[i] - sx;
+    pushRegion(tft, sx, textY_, w, TIMER_FONT.height);
+    pixels += w * TIMER_FONT.height;
+  }
+  if (pixels > 0) {
+    stats_.lastPixels = pixels;
+  }
+  return pixels;
+}
+
+// Push a window of the sprite (sprite coordinates) to the panel. With DMA
+// the transfer is queued and left running until finishDisplayFrame().
+void TimerReadout::pushRegion(TFT_eSPI& tft, int sx, int sy, int w, int h) {
+  if (!dmaReady || dmaStage_ == nullptr) {
+    sprite_->pushSprite(box_.x + sx, box_.y + sy, sx, sy, w, h);
+    return;
+  }
+
+  if (!dmaInFlight) {
+    tft.startWrite();
+    dmaInFlight = true;
+  }
+
+  uint16_t* spritePixels = (uint16_t*)sprite_->getPointer();
+  if (sx == 0 && sy == 0 && w == box_.w && h == box_.h) {
+    // Whole sprite is contiguous, push it in place
+    tft.pushImageDMA(box_.x, box_.y, box_.w, box_.h, spritePixels);
+    return;
+  }
+
+  // Otherwise this is a run of changed cells: copy its rows into the
+  // staging buffer. Runs within one frame never overlap in x, so each gets
+  // its own slice and none has to wait for the previous transfer.
+  uint16_t* stage = dmaStage_ + sx * h;
+  for (int row = 0; row < h; row++) {
+    memcpy(stage + row * w, spritePixels + (sy + row) * box_.w + sx, w * sizeof(uint16_t));
+  }
+  tft.pushImageDMA(box_.x + sx, box_.y + sy, w, h, stage);
+}
+
+// ===== COMPOSITOR =====
+
+void Screen::add(Widget* widget) {
+  if (count_ < MAX_SCREEN_WIDGETS) {
+    widgets_[count_++] = widget;
+  }
+}
+
+void Screen::addTarget(const Widget* widget, uint8_t action) {
+  if (targetCount_ < MAX_SCREEN_HITS) {
+    targets_[targetCount_++] = { widget, action };
+  }
+}
+
+uint8_t Screen::hitTest(int x, int y) const {
+  for (int i = targetCount_ - 1; i >= 0; i--) {
+    if (targets_[i].widget->bounds().contains(x, y)) {
+      return targets_[i].action;
+    }
+  }
+  return defaultAction_;
+}
+
+void Compositor::addDirty(const Rect& r) {
+  Rect clipped = r.intersect(SCREEN_RECT);
+  if (clipped.isEmpty()) {
+    return;
+  }
+  if (dirtyCount_ == MAX_DIRTY) {
+    dirty_[0] = SCREEN_RECT;
+    dirtyCount_ = 1;
+    return;
+  }
+  dirty_[dirtyCount_++] = clipped;
+}
+
+// Union overlapping rectangles until none overlap, so no pixel is painted twice
+void Compositor::mergeDirty() {
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (int i = 0; i < dirtyCount_ && !merged; i++) {
+      for (int j = i + 1; j < dirtyCount_; j++) {
+        if (dirty_[i].intersects(dirty_[j])) {
+          dirty_[i] = dirty_[i].unite(dirty_[j]);
+          dirty_[j] = dirty_[--dirtyCount_];
+          merged = true;
+          break;
+        }
+      }
+    }
+  }
+}
+
+uint32_t Compositor::render(TFT_eSPI& tft, const Screen& screen) {
+  PROFILE_SCOPE(PROF_COMPOSITE);
+  int count = screen.count();
+  Rect boxes[MAX_SCREEN_WIDGETS];
+  uint32_t sigs[MAX_SCREEN_WIDGETS];
+  for (int i = 0; i < count; i++) {
+    boxes[i] = screen.widget(i)->bounds();
+    sigs[i] = screen.widget(i)->signature();
+  }
+
+  // Damage: widgets whose box or content differs from what is on the
+  // panel, and the boxes of anything drawn last frame that is now gone
+  dirtyCount_ = 0;
+  if (!valid_ || screen.background() != drawnBg_) {
+    addDirty(SCREEN_RECT);
+  } else {
+    bool kept[MAX_SCREEN_WIDGETS] = { false };
+    for (int i = 0; i < count; i++) {
+      bool same = false;
+      for (int d = 0; d < drawnCount_ && !same; d++) {
+        if (drawn_[d].widget == screen.widget(i) && drawn_[d].box == boxes[i] && drawn_[d].signature == sigs[i]) {
+          kept[d] = same = true;
+        }
+      }
+      if (!same) {
+        addDirty(boxes[i]);
+      }
+    }
+    for (int d = 0; d < drawnCount_; d++) {
+      if (!kept[d]) {
+        addDirty(drawn_[d].box);
+      }
+    }
+  }
+  mergeDirty();
+
+  // Repaint each damaged rectangle: background between widgets, then the
+  // visible part of each widget
+  uint32_t pixels = 0;
+  bool painted[MAX_SCREEN_WIDGETS] = { false };
+  for (int r = 0; r < dirtyCount_; r++) {
+    const Rect& area = dirty_[r];
+    Rect holes[MAX_SCREEN_WIDGETS];
+    int holeCount = 0;
+    for (int i = 0; i < count; i++) {
+      Rect hole = boxes[i].intersect(area);
+      if (!hole.isEmpty()) {
+        holes[holeCount++] = hole;
+      }
+    }
+    finishDisplayFrame(tft);
+    pixels += fillSpans(tft, area, holes, holeCount, screen.background());
+
+    for (int i = 0; i < count; i++) {
+      Rect vis = boxes[i].intersect(area);
+      if (!vis.isEmpty()) {
+        finishDisplayFrame(tft);
+        pixels += screen.widget(i)->paint(tft, vis);
+        painted[i] = painted[i] || vis == boxes[i];
+      }
+    }
+  }
+
+  // Widgets that were not repainted push their own incremental changes
+  for (int i = 0; i < count; i++) {
+    if (!painted[i]) {
+      pixels += screen.widget(i)->update(tft);
+    }
+  }
+
+  drawnCount_ = count;
+  for (int i = 0; i < count; i++) {
+    drawn_[i] = { screen.widget(i), boxes[i], sigs[i] };
+  }
+  drawnBg_ = screen.background();
+  valid_ = true;
+
+  finishDisplayFrame(tft);
+  lastDirtyRects_ = dirtyCount_;
+  lastPixels_ = pixels;
+  return pixels;
+}
@@ -0,0 +1,250 @@
+#pragma once
+// ===== RETAINED-MODE UI =====
+// Widgets remember what they show. Each frame the Compositor compares the
+// widgets of the current screen with what it last put on the panel, merges
+// the damaged rectangles, and repaints only those: background spans between
+// widgets first, then each widget's box, so every pixel is pushed once.
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+struct Rect {
+  int16_t x, y, w, h;
+
+  bool isEmpty() const { return w <= 0 || h <= 0; }
+  uint32_t area() const { return isEmpty() ? 0 : (uint32_t)w * h; }
+  bool operator==(const Rect& o) const { return x == o.x && y == o.y && w == o.w && h == o.h; }
+  bool contains(int px, int py) const { return px >= x && px < x + w && py >= y && py < y + h; }
+  bool intersects(const Rect& o) const;
+  Rect intersect(const Rect& o) const;
+  Rect unite(const Rect& o) const;
+};
+
+const Rect SCREEN_RECT = { 0, 0, 320, 240 };
+const int MAX_LAYOUT_HOLES = 16;
+const int MAX_SCREEN_WIDGETS = 16;
+const int MAX_SCREEN_HITS = 8;
+
+// Fill 'area' minus 'holes' (which must not overlap) with as few rectangles
+// as possible. Returns pixels filled.
+uint32_t fillSpans(TFT_eSPI& tft, const Rect& area, const Rect* holes, int holeCount, uint16_t color);
+
+// Box a GLCD-font string occupies when drawn with drawString at (x, y)
+Rect glcdTextRect(const char* str, uint8_t size, uint8_t datum, int x, int y);
+
+// Pre-rendered glyph fonts from digit-atlas.h
+struct AtlasFont;
+extern const AtlasFont& TIMER_FONT;
+extern const AtlasFont& CLOCK_FONT;
+
+bool atlasCovers(const AtlasFont& font, const char* str);
+int atlasTextWidth(const AtlasFont& font, const char* str);
+int atlasHeight(const AtlasFont& font);
+
+// DMA for sprite pushes. Transfers are queued and left running until
+// finishDisplayFrame(), which the compositor calls at the end of a frame.
+bool initDisplayDMA(TFT_eSPI& tft);
+void finishDisplayFrame(TFT_eSPI& tft);
+
+// ===== WIDGETS =====
+class Widget {
+public:
+  virtual ~Widget() {}
+
+  virtual Rect bounds() const = 0;
+
+  // Identity of what the widget shows. A change repaints its whole box.
+  virtual uint32_t signature() const = 0;
+
+  // Paint the part of bounds() inside clip, every pixel opaquely.
+  // Returns pixels written.
+  virtual uint32_t paint(TFT_eSPI& tft, const Rect& clip) = 0;
+
+  // Push changes that don't alter the signature (timer digits).
+  // Returns pixels written.
+  virtual uint32_t update(TFT_eSPI& tft) { return 0; }
+};
+
+// GLCD text. The box defaults to the text's own box; a fixed box is
+// filled around the text, which suits lines whose length changes.
+class Label : public Widget {
+public:
+  Label(int x, int y, uint8_t size, uint8_t datum, const char* text = "", Rect box = { 0, 0, 0, 0 });
+
+  void setText(const char* text);
+  void setColors(uint16_t fg, uint16_t bg);
+  const char* text() const { return text_; }
+
+  Rect bounds() const override;
+  uint32_t signature() const override;
+  uint32_t paint(TFT_eSPI& tft, const Rect& clip) override;
+
+private:
+  int16_t x_, y_;
+  uint8_t size_, datum_;
+  Rect box_;
+  uint16_t fg_ = TFT_WHITE, bg_ = TFT_BLACK;
+  char text_[64];
+};
+
+// Outlined button with a centred GLCD label
+class Button : public Widget {
+public:
+  Button(Rect box, const char* label, uint8_t textSize = 1);
+
+  void setColors(uint16_t fg, uint16_t bg);
+  const Rect& box() const { return box_; }
+
+  Rect bounds() const override { return box_; }
+  uint32_t signature() const override;
+  uint32_t paint(TFT_eSPI& tft, const Rect& clip) override;
+
+private:
+  Rect box_;
+  const char* label_;
+  uint8_t textSize_;
+  uint16_t fg_ = TFT_WHITE, bg_ = TFT_BLACK;
+};
+
+// Wall clock: atlas digits, falling back to GLCD for text the atlas lacks
+// ("No WiFi"). Text is anchored bottom-left at (x, baseline).
+class Clock : public Widget {
+public:
+  Clock(Rect box, int x, int baseline);
+
+  // Returns true if the text changed
+  bool setText(const char* text);
+  void setColors(uint16_t fg, uint16_t bg);
+
+  Rect bounds() const override { return box_; }
+  uint32_t signature() const override;
+  uint32_t paint(TFT_eSPI& tft, const Rect& clip) override;
+
+private:
+  Rect box_;
+  int16_t x_, baseline_;
+  uint16_t fg_ = TFT_WHITE, bg_ = TFT_BLACK;
+  char text_[16];
+};
+
+// hh:mm:ss readout in atlas digits. With a sprite, glyphs are decoded
+// off-screen and only the cells that changed are pushed (via DMA when
+// available); without one, the text is blitted straight to the panel.
+// The sprite is allocated once by begin().
+class TimerReadout : public Widget {
+public:
+  static const int CELLS = 8;  // "hh:mm:ss" = 6 digits + 2 colons, always (setSeconds() clamps)
+
+  struct Stats {
+    uint32_t ticks;         // update() calls
+    uint32_t glyphs;        // Glyph cells decoded and pushed
+    uint32_t decodeMicros;  // Time spent decoding them
+    uint32_t lastPixels;    // Pixels pushed by the last paint/update
+  };
+
+  TimerReadout(Rect box, bool useSprite = false);
+
+  // Allocate the sprite and DMA staging buffer. Returns false if a sprite
+  // was wanted but could not be allocated (direct blitting is used instead).
+  bool begin(TFT_eSPI& tft);
+
+  void setSeconds(unsigned long seconds);
+  void setColors(uint16_t fg, uint16_t bg);
+
+  // Read and reset the counters
+  Stats takeStats();
+
+  Rect bounds() const override { return box_; }
+  uint32_t signature() const override;
+  uint32_t paint(TFT_eSPI& tft, const Rect& clip) override;
+  uint32_t update(TFT_eSPI& tft) override;
+
+private:
+  void layoutCells();
+  void decodeText(int fromCell, int toCell);
+  void pushRegion(TFT_eSPI& tft, int sx, int sy, int w, int h);
+
+  Rect box_;
+  bool useSprite_;
+  TFT_eSprite* sprite_ = nullptr;
+  uint16_t* dmaStage_ = nullptr;
+  uint16_t fg_ = TFT_WHITE, bg_ = TFT_BLACK;
+  char text_[16];
+  int cellX_[CELLS + 1];   // Cell left edges inside the box
+  int textY_ = 0;          // Glyph top inside the box
+  bool spriteStale_ = true;  // Sprite background needs repainting (new colours)
+  char spriteCells_[CELLS];  // Glyph decoded into the sprite per cell (0 = none)
+  char drawnCells_[CELLS];   // Glyph on the panel per cell (0 = unknown)
+  Stats stats_ = {};
+};
+
+// ===== COMPOSITOR =====
+// A screen is also its own hit-test table: touch targets are widgets, so a
+// target is wherever the widget is drawn. Actions are app-defined ids
+// (0 = none). Targets are kept apart from the widget list, which may be
+// rebuilt on the render task while touches are being dispatched.
+class Screen {
+public:
+  explicit Screen(uint16_t background = TFT_BLACK) : bg_(background) {}
+
+  void add(Widget* widget);
+  void clear() { count_ = 0; }
+
+  // Make 'widget' a touch target for 'action'; later targets win overlaps
+  void addTarget(const Widget* widget, uint8_t action);
+  // Action for touches that miss every target
+  void setDefaultAction(uint8_t action) { defaultAction_ = action; }
+  uint8_t hitTest(int x, int y) const;
+
+  void setBackground(uint16_t color) { bg_ = color; }
+  uint16_t background() const { return bg_; }
+  int count() const { return count_; }
+  Widget* widget(int i) const { return widgets_[i]; }
+
+private:
+  Widget* widgets_[MAX_SCREEN_WIDGETS];
+  int count_ = 0;
+  uint16_t bg_;
+
+  struct Target {
+    const Widget* widget;
+    uint8_t action;
+  };
+  Target targets_[MAX_SCREEN_HITS];
+  int targetCount_ = 0;
+  uint8_t defaultAction_ = 0;
+};
+
+class Compositor {
+public:
+  // Forget what is on the panel; the next render repaints everything
+  void invalidateAll() { valid_ = false; }
+
+  // Bring the panel in line with 'screen'. Returns pixels pushed.
+  uint32_t render(TFT_eSPI& tft, const Screen& screen);
+
+  int lastDirtyRects() const { return lastDirtyRects_; }
+  uint32_t lastPixels() const { return lastPixels_; }
+
+private:
+  struct Entry {
+    Widget* widget;
+    Rect box;
+    uint32_t signature;
+  };
+
+  static const int MAX_DIRTY = 2 * MAX_SCREEN_WIDGETS + 1;
+
+  void addDirty(const Rect& r);
+  void mergeDirty();
+
+  Entry drawn_[MAX_SCREEN_WIDGETS];
+  int drawnCount_ = 0;
+  uint16_t drawnBg_ = 0;
+  bool valid_ = false;
+
+  Rect dirty_[MAX_DIRTY];
+  int dirtyCount_ = 0;
+  int lastDirtyRects_ = 0;
+  uint32_t lastPixels_ = 0;
+};
@@ -0,0 +1,174 @@
+"""
+Generate src/digit-atlas.h: anti-aliased 7-segment style glyphs for the
+timer readout and the clock, run-length encoded for PROGMEM.
+
+Runs standalone (python tools/gen_digit_atlas.py) or as a PlatformIO
+pre-build script, in which case the header is only rewritten when this
+script is newer than it.
+
+RLE format, row-major over the glyph box (the same order pixels stream
+into a TFT address window): one byte per run, top 2 bits = coverage level
+(0 = background .. 3 = foreground), low 6 bits = run length - 1.
+"""
+import math
+import os
+
+# Segment sets per character (a=top, b=upper right, c=lower right,
+# d=bottom, e=lower left, f=upper left, g=middle)
+SEGMENTS = {
+    "0": "abcdef", "1": "bc", "2": "abdeg", "3": "abcdg", "4": "bcfg",
+    "5": "acdfg", "6": "acdefg", "7": "abc", "8": "abcdefg", "9": "abcdfg",
+    "A": "abcefg", "P": "abefg",
+}
+
+# name, glyph width, height, stroke thickness, segment end gap, colon width,
+# letter spacing, characters
+FONTS = [
+    ("timer", 26, 44, 6.0, 5.0, 10, 4, "0123456789:"),
+    ("clock", 10, 18, 2.5, 2.0, 4, 2, "0123456789:APM"),
+]
+
+SUPERSAMPLE = 4
+
+
+def seg_lines(w, h, t, gap):
+    """Capsule centre lines for each segment in a w x h box."""
+    r = t / 2.0
+    left, right = r + 0.5, w - r - 0.5
+    top, bot = r + 0.5, h - r - 0.5
+    mid = h / 2.0
+    return {
+        "a": ((left + gap, top), (right - gap, top)),
+        "b": ((right, top + gap), (right, mid - gap)),
+        "c": ((right, mid + gap), (right, bot - gap)),
+        "d": ((left + gap, bot), (right - gap, bot)),
+        "e": ((left, mid + gap), (left, bot - gap)),
+        "f": ((left, top + gap), (left, mid - gap)),
+        "g": ((left + gap, mid), (right - gap, mid)),
+    }
+
+
+def glyph_shapes(ch, w, h, t, gap):
+    """List of (p0, p1) capsules making up a character."""
+    segs = seg_lines(w, h, t, gap)
+    if ch in SEGMENTS:
+        return [segs[s] for s in SEGMENTS[ch]]
+    if ch == ":":
+        cx = w / 2.0
+        return [((cx, h * 0.32), (cx, h * 0.32)), ((cx, h * 0.68), (cx, h * 0.68))]
+    if ch == "M":
+        (l0, _), (l1, _) = segs["f"][0], segs["e"][1]
+        (r0, _), (r1, _) = segs["b"][0], segs["c"][1]
+        top, bot = segs["f"][0][1], segs["e"][1][1]
+        centre = (w / 2.0, h * 0.45)
+        return [((l0, top), (l1, bot)), ((r0, top), (r1, bot)),
+                ((l0, top), centre), ((r0, top), centre)]
+    raise ValueError("no shape for %r" % ch)
+
+
+def seg_distance(px, py, p0, p1):
+    (x0, y0), (x1, y1) = p0, p1
+    dx, dy = x1 - x0, y1 - y0
+    length2 = dx * dx + dy * dy
+    u = 0.0 if length2 == 0 else max(0.0, min(1.0, ((px - x0) * dx + (py - y0) * dy) / length2))
+    return math.hypot(px - (x0 + u * dx), py - (y0 + u * dy))
+
+
+def rasterize(ch, w, h, t, gap):
+    """Return row-major coverage levels 0..3 for a glyph."""
+    shapes = glyph_shapes(ch, w, h, t, gap)
+    r = t / 2.0
+    levels = []
+    n = SUPERSAMPLE
+    for y in range(h):
+        for x in range(w):
+            hits = 0
+            for sy in range(n):
+                for sx in range(n):
+                    px = x + (sx + 0.5) / n
+                    py = y + (sy + 0.5) / n
+                    if any(seg_distance(px, py, a, b) <= r for a, b in shapes):
+                        hits += 1
+            levels.append(int(round(3.0 * hits / (n * n))))
+    return levels
+
+
+def rle_encode(levels):
+    out = []
+    i = 0
+    while i < len(levels):
+        level = levels[i]
+        run = 1
+        while i + run < len(levels) and levels[i + run] == level and run < 64:
+            run += 1
+        out.append((level << 6) | (run - 1))
+        i += run
+    return out
+
+
+def build():
+    lines = [
+        "// Generated by tools/gen_digit_atlas.py - do not edit by hand",
+        "// Anti-aliased 7-segment glyphs, RLE: [level:2][run-1:6] per byte, row-major",
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        "struct AtlasGlyph {",
+        "  char ch;",
+        "  uint8_t w;",
+        "  uint16_t offset;  // Into the font's RLE data",
+        "  uint16_t size;    // RLE bytes",
+        "};",
+        "",
+        "struct AtlasFont {",
+        "  const AtlasGlyph* glyphs;",
+        "  uint8_t count;",
+        "  uint8_t height;",
+        "  uint8_t spacing;  // Blank columns between glyphs",
+        "  const uint8_t* data;",
+        "};",
+    ]
+    for name, gw, gh, thick, gap, colon_w, spacing, chars in FONTS:
+        data = []
+        glyphs = []
+        raw = 0
+        for ch in chars:
+            w = colon_w if ch == ":" else gw
+            enc = rle_encode(rasterize(ch, w, gh, thick, gap))
+            glyphs.append((ch, w, len(data), len(enc)))
+            data.extend(enc)
+            raw += w * gh * 2
+        lines.append("")
+        lines.append("// %s: %dx%d, %d glyphs, %d RLE bytes (%d bytes as RGB565)" %
+                     (name, gw, gh, len(chars), len(data), raw))
+        lines.append("const uint8_t %sAtlasData[] PROGMEM = {" % name)
+        for i in range(0, len(data), 16):
+            lines.append("  " + ", ".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+        lines.append("};")
+        lines.append("")
+        lines.append("const AtlasGlyph %sAtlasGlyphs[] = {" % name)
+        for ch, w, off, size in glyphs:
+            lines.append("  { '%s', %d, %d, %d }," % (ch, w, off, size))
+        lines.append("};")
+        lines.append("")
+        lines.append("const AtlasFont %sAtlas = { %sAtlasGlyphs, %d, %d, %d, %sAtlasData };" %
+                     (name, name, len(chars), gh, spacing, name))
+    return "\n".join(lines) + "\n"
+
+
+def main(project_dir):
+    script = os.path.join(project_dir, "tools", "gen_digit_atlas.py")
+    out = os.path.join(project_dir, "src", "digit-atlas.h")
+    if os.path.exists(out) and os.path.getmtime(out) >= os.path.getmtime(script):
+        return
+    with open(out, "w", newline="\n") as f:
+        f.write(build())
+    print("Generated %s" % out)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    main(env.subst("$PROJECT_DIR"))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        main(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
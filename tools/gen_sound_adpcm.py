@@ -0,0 +1,191 @@
+"""
+Convert a WAV to the sound file format the timer plays from LittleFS
+(/sounds/, see AudioFileSourceReadAhead in src/audio_file_stream.cpp): a
+mono IMA-ADPCM WAV decoded by AudioGeneratorImaAdpcm (src/audio_adpcm.cpp).
+
+The chime source is 44.1 kHz 16-bit stereo, but it ends up on one 8-bit DAC
+pin, so the stereo pair and the top octave are wasted flash. The two
+channels are averaged, low-pass resampled to SOUND_RATE and encoded as
+4-bit IMA-ADPCM (the standard WAVE_FORMAT_IMA_ADPCM layout, 0x0011), about
+1/16 of the source size at 22.05 kHz.
+
+As a PlatformIO pre-build script it builds data/sounds/happy-chimes.wav
+from assets/happy-chimes.wav, at custom_sound_rate from platformio.ini,
+when this script or the source is newer or the rate has changed; upload it
+with `pio run -t uploadfs`. Standalone it converts any 16-bit PCM WAV:
+
+    python tools/gen_sound_adpcm.py [in.wav out.wav] [rate]
+"""
+import math
+import os
+import struct
+import sys
+
+SOUND_RATE = 22050         # The synth's rate: no DAC retune when sounds overlap
+BLOCK_ALIGN = 512          # Bytes per block, header included (decoder max: IMA_MAX_BLOCK_ALIGN)
+SAMPLES_PER_BLOCK = (BLOCK_ALIGN - 4) * 2 + 1
+SINC_TAPS = 16             # Filter half-width, in input samples at 1:1
+
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143,
+    157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658,
+    724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024,
+    3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767,
+]
+
+
+def read_wav(path):
+    """Return (rate, mono samples) from a 16-bit PCM WAV."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[0:4] != b"RIFF" or data[8:12] != b"WAVE":
+        raise ValueError("%s is not a WAV file" % path)
+    pos = 12
+    fmt = None
+    pcm = None
+    while pos + 8 <= len(data):
+        chunk, size = struct.unpack_from("<4sI", data, pos)
+        body = data[pos + 8:pos + 8 + size]
+        if chunk == b"fmt ":
+            fmt = struct.unpack_from("<HHIIHH", body)
+        elif chunk == b"data":
+            pcm = body
+        pos += 8 + size + (size & 1)
+    if fmt is None or pcm is None:
+        raise ValueError("%s has no fmt or data chunk" % path)
+    tag, channels, rate, _, _, bits = fmt
+    if tag != 1 or bits != 16:
+        raise ValueError("%s: need 16-bit PCM, got format %d, %d bits" % (path, tag, bits))
+    frames = len(pcm) // (2 * channels)
+    raw = struct.unpack_from("<%dh" % (frames * channels), pcm)
+    mono = [sum(raw[i * channels:(i + 1) * channels]) / float(channels) for i in range(frames)]
+    return rate, mono
+
+
+def resample(samples, src_rate, dst_rate):
+    """Windowed-sinc resample; cut-off at 0.45 of the lower rate."""
+    if src_rate == dst_rate:
+        return samples
+    ratio = float(src_rate) / dst_rate
+    cutoff = 0.9 * min(1.0, 1.0 / ratio) / 2.0   # Cycles per input sample
+    half = int(math.ceil(SINC_TAPS * max(1.0, ratio)))
+    out_len = int(len(samples) / ratio)
+    out = []
+    for n in range(out_len):
+        t = n * ratio
+        centre = int(t)
+        acc = 0.0
+        norm = 0.0
+        for k in range(centre - half + 1, centre + half + 1):
+            if k < 0 or k >= len(samples):
+                continue
+            x = t - k
+            w = 0.5 + 0.5 * math.cos(math.pi * x / half)  # Hann
+            s = 2.0 * cutoff if x == 0 else math.sin(2.0 * math.pi * cutoff * x) / (math.pi * x)
+            acc += samples[k] * s * w
+            norm += s * w
+        out.append(acc / norm if norm else 0.0)
+    return out
+
+
+def clamp16(v):
+    return max(-32768, min(32767, int(round(v))))
+
+
+def encode_nibble(sample, predictor, index):
+    """Encode one sample; returns (nibble, predictor, index) as the decoder sees them."""
+    step = STEP_TABLE[index]
+    diff = sample - predictor
+    nibble = 0
+    if diff < 0:
+        nibble = 8
+        diff = -diff
+    delta = step >> 3
+    if diff >= step:
+        nibble |= 4
+        diff -= step
+        delta += step
+    step >>= 1
+    if diff >= step:
+        nibble |= 2
+        diff -= step
+        delta += step
+    step >>= 1
+    if diff >= step:
+        nibble |= 1
+        delta += step
+    predictor = predictor - delta if nibble & 8 else predictor + delta
+    predictor = max(-32768, min(32767, predictor))
+    index = max(0, min(88, index + INDEX_TABLE[nibble]))
+    return nibble, predictor, index
+
+
+def encode_adpcm(samples):
+    pcm = [clamp16(s) for s in samples]
+    pad = (-len(pcm)) % SAMPLES_PER_BLOCK
+    pcm.extend([0] * pad)
+    out = bytearray()
+    index = 0
+    for start in range(0, len(pcm), SAMPLES_PER_BLOCK):
+        block = pcm[start:start + SAMPLES_PER_BLOCK]
+        predictor = block[0]
+        out += struct.pack("<hBB", predictor, index, 0)
+        for i in range(1, len(block), 2):
+            lo, predictor, index = encode_nibble(block[i], predictor, index)
+            hi, predictor, index = encode_nibble(block[i + 1], predictor, index)
+            out.append(lo | (hi << 4))
+    return out, len(samples)
+
+
+def build_wav(rate, adpcm, sample_count):
+    byte_rate = rate * BLOCK_ALIGN // SAMPLES_PER_BLOCK
+    fmt = struct.pack("<HHIIHHHH", 0x0011, 1, rate, byte_rate, BLOCK_ALIGN, 4, 2, SAMPLES_PER_BLOCK)
+    fact = struct.pack("<I", sample_count)
+    body = (b"WAVE" + b"fmt " + struct.pack("<I", len(fmt)) + fmt +
+            b"fact" + struct.pack("<I", len(fact)) + fact +
+            b"data" + struct.pack("<I", len(adpcm)) + adpcm)
+    return b"RIFF" + struct.pack("<I", len(body)) + body
+
+
+def convert(src, dst, rate):
+    src_rate, mono = read_wav(src)
+    samples = resample(mono, src_rate, rate)
+    adpcm, count = encode_adpcm(samples)
+    wav = build_wav(rate, adpcm, count)
+    with open(dst, "wb") as f:
+        f.write(wav)
+    print("Generated %s: %d Hz, %.2f s, %d bytes (source %d bytes)" %
+          (dst, rate, count / float(rate), len(wav), os.path.getsize(src)))
+
+
+def wav_rate(path):
+    with open(path, "rb") as f:
+        header = f.read(28)
+    return struct.unpack_from("<I", header, 24)[0] if len(header) == 28 else None
+
+
+def main(project_dir, rate):
+    script = os.path.join(project_dir, "tools", "gen_sound_adpcm.py")
+    src = os.path.join(project_dir, "assets", "happy-chimes.wav")
+    dst = os.path.join(project_dir, "data", "sounds", "happy-chimes.wav")
+    if (os.path.exists(dst) and wav_rate(dst) == rate and
+            os.path.getmtime(dst) >= max(os.path.getmtime(script), os.path.getmtime(src))):
+        return
+    os.makedirs(os.path.dirname(dst), exist_ok=True)
+    convert(src, dst, rate)
+
+
+try:
+    Import("env")  # noqa: F821 - provided by PlatformIO/SCons
+    main(env.subst("$PROJECT_DIR"), int(env.GetProjectOption("custom_sound_rate", SOUND_RATE)))  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        args = sys.argv[1:]
+        if len(args) >= 2:
+            convert(args[0], args[1], int(args[2]) if len(args) > 2 else SOUND_RATE)
+        else:
+            main(os.path.dirname(os.path.dirname(os.path.abspath(__file__))),
+                 int(args[0]) if args else SOUND_RATE)